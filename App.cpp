@@ -1,10 +1,12 @@
 #include "App.h"
 #include "MainFrame.h"
+#include "PerfTrace.h"
 #include <wx/wx.h>
 
 wxIMPLEMENT_APP(App);
 
 bool App::OnInit() {
+	SetTraceThreadName("UI");
 	MainFrame* frame = new MainFrame("Assets Tracker");
 	frame->SetClientSize(800, 600);
 	frame->Center();
@@ -0,0 +1,675 @@
+#include "AssetEngine.h"
+#include "PerfTrace.h"
+#include "PortfolioGenerator.h"
+#include "RentalBilling.h"
+#include "SpanningForest.h"
+#include "WorkerPool.h"
+#include <wx/init.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// Benchmark engine tanpa GUI. Setiap kasus mengosongkan registry, mengisi
+// `records` data langsung ke struktur global (tidak diukur), lalu mengukur
+// latensi per operasi. Hasil satu baris per (operasi, ukuran) dalam JSON Lines
+// atau CSV sehingga bisa dibandingkan antar commit.
+//
+// Default-nya data seragam yang murah dibuat; --portfolio memakai generator
+// portofolio sintetis (kategori Zipf, graph scale-free, tree dalam) supaya
+// distribusinya mirip data nyata.
+//
+//   assets_benchmark [--sizes=1000,10000] [--ops=1000] [--budget-ms=2000]
+//                    [--seed=42] [--filter=Asset] [--format=json|csv] [--portfolio]
+//                    [--trace=trace.json]
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    struct BenchmarkOptions {
+        std::vector<size_t> sizes;
+        size_t operations;
+        long budgetMilliseconds;
+        unsigned seed;
+        std::string filter;
+        bool csv;
+        bool portfolio;
+        std::string tracePath;   // kosong = tanpa trace
+    };
+
+    struct BenchmarkResult {
+        std::string name;
+        size_t records;
+        double setupMilliseconds;
+        std::vector<uint64_t> samples;   // nanodetik per operasi
+    };
+
+    const char* CATEGORY_NAMES[] = { "Kost", "Gedung", "Rumah", "Emas", "Kendaraan", "Elektronik" };
+    const size_t CATEGORY_COUNT = sizeof(CATEGORY_NAMES) / sizeof(CATEGORY_NAMES[0]);
+    const size_t SUB_ASSETS_PER_TREE = 20;
+
+    double ElapsedMilliseconds(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // ID bulk-load memakai format yang sama dengan GenerateUniqueAssetId
+    wxString LoadedAssetId(size_t index) {
+        return wxString::Format("%c%07zu", CATEGORY_NAMES[index % CATEGORY_COUNT][0], index + 1);
+    }
+
+    // REGISTRY LOADERS (tidak ikut diukur)
+
+    void ResetRegistry() {
+        ClearAllData();
+        InitializeDefaultData();
+    }
+
+    void LoadAssets(size_t count) {
+        CategoryId categoryIds[CATEGORY_COUNT];
+        for (size_t i = 0; i < CATEGORY_COUNT; i++) {
+            categoryIds[i] = daftarKategori.Add(CATEGORY_NAMES[i]);
+        }
+        for (size_t i = 0; i < count; i++) {
+            wxString id = LoadedAssetId(i);
+            EntityKey key = assetKeys.Intern(id);
+            daftarAset.push_back(Aset(key, wxString::Format("Aset %zu", i), categoryIds[i % CATEGORY_COUNT]));
+            daftarKategori.AttachAsset(daftarAset.getTail());
+            daftarDetailNilaiAset.push_back(AssetValueDetails(key, 1000 + static_cast<int>(i % 9000), 10, 5));
+        }
+        BumpDataGeneration(DATA_ASET | DATA_NILAI_ASET);
+    }
+
+    void LoadConnections(size_t assetCount, size_t connectionCount, std::mt19937& random) {
+        std::uniform_int_distribution<size_t> pick(0, assetCount - 1);
+        for (size_t i = 0; i < connectionCount; i++) {
+            size_t from = pick(random);
+            size_t to = pick(random);
+            if (from == to) to = (to + 1) % assetCount;
+            daftarKoneksiAset.push_back(AssetConnection(assetKeys.Intern(LoadedAssetId(from)), assetKeys.Intern(LoadedAssetId(to)),
+                1 + static_cast<int>(i % 10)));
+        }
+        assetClusters.Invalidate();
+        BumpDataGeneration(DATA_KONEKSI);
+    }
+
+    // Sub-aset dibagi ke pohon berisi SUB_ASSETS_PER_TREE node, parent acak
+    // di dalam pohon yang sama. ID mengikuti GenerateUniqueSubAssetId.
+    void LoadSubAssets(size_t count, std::mt19937& random) {
+
+        size_t treeCount = (count + SUB_ASSETS_PER_TREE - 1) / SUB_ASSETS_PER_TREE;
+        for (size_t tree = 0; tree < treeCount; tree++) {
+            wxString assetId = LoadedAssetId(tree);
+            EntityKey assetKey = assetKeys.Intern(assetId);
+            AssetTree<SubAssetHandle>* assetTree = new AssetTree<SubAssetHandle>();
+            TreeNode<SubAssetHandle>* root = assetTree->createNode(
+                subAssetPool.create(subAssetKeys.Intern("ROOT-" + assetId), "Root of " + assetId, assetKey));
+            assetTree->setRoot(root);
+            assetTrees.push_back(assetTree);
+
+            std::vector<TreeNode<SubAssetHandle>*> nodes(1, root);
+            size_t inTree = std::min(SUB_ASSETS_PER_TREE, count - tree * SUB_ASSETS_PER_TREE);
+            for (size_t j = 0; j < inTree; j++) {
+                SubAssetHandle subAsset = subAssetPool.create(subAssetKeys.Intern(wxString::Format("%s-SUB%03zu", assetId, j + 1)),
+                    wxString::Format("Unit %zu", j + 1), assetKey);
+                daftarSubAset.push_back(subAsset);
+
+                std::uniform_int_distribution<size_t> pickParent(0, nodes.size() - 1);
+                TreeNode<SubAssetHandle>* node = assetTree->createNode(subAsset);
+                nodes[pickParent(random)]->addChild(node);
+                nodes.push_back(node);
+
+                // Satu lease per unit tersebar di 2024-2026, tanpa memakai `random`
+                size_t n = tree * SUB_ASSETS_PER_TREE + j;
+                LedgerDay start = LedgerDayFromDate(2024, 1, 1) + static_cast<LedgerDay>((n * 37) % 900);
+                rentalLedger.AddLeaseUnindexed(subAssetPool.get(subAsset).key, start,
+                    start + 30 + static_cast<LedgerDay>((n * 53) % 365), 1500000, "Penyewa");
+            }
+        }
+        rentalLedger.RebuildIndex();
+        subAssetIndex.Rebuild(assetTrees, daftarSubAset);
+        BumpDataGeneration(DATA_SUB_ASET);
+    }
+
+    void LoadTenders(size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            queueTenderProjects.enqueue(TenderProject(tenderKeys.Intern(wxString::Format("BT%07zu", i + 1)),
+                wxString::Format("Proyek %zu", i), CATEGORY_NAMES[i % CATEGORY_COUNT], "", "Pending",
+                "01/01/2025", static_cast<int>(i % 100000), "Klien", 1 + static_cast<int>(i % 5)));
+        }
+    }
+
+    // Portofolio sintetis; seed diambil dari random kasus supaya tetap deterministik
+    PortfolioSpec BenchmarkSpec(size_t assetCount, std::mt19937& random) {
+        return DefaultPortfolioSpec(assetCount, static_cast<unsigned>(random()));
+    }
+
+    void LoadGeneratedPortfolio(const PortfolioSpec& spec) {
+        Portfolio portfolio;
+        GeneratePortfolio(spec, portfolio);
+        LoadPortfolio(portfolio);
+    }
+
+    // `records` aset; portofolio juga membawa koneksi, sub-aset dan tender
+    void LoadAssetFixture(size_t records, bool portfolio, std::mt19937& random) {
+        if (portfolio) LoadGeneratedPortfolio(BenchmarkSpec(records, random));
+        else LoadAssets(records);
+    }
+
+    void LoadConnectionFixture(size_t records, bool portfolio, std::mt19937& random) {
+        if (portfolio) {
+            LoadGeneratedPortfolio(BenchmarkSpec(records, random));
+            return;
+        }
+        LoadAssets(records);
+        LoadConnections(records, records, random);
+    }
+
+    // `records` sub-aset
+    void LoadSubAssetFixture(size_t records, bool portfolio, std::mt19937& random) {
+        if (portfolio) {
+            PortfolioSpec spec = BenchmarkSpec(std::max<size_t>(1, records / 2), random);
+            spec.subAssetCount = records;
+            LoadGeneratedPortfolio(spec);
+            return;
+        }
+        LoadAssets(std::max<size_t>(1, records / SUB_ASSETS_PER_TREE));
+        LoadSubAssets(records, random);
+    }
+
+    // `records` tender, tanpa aset
+    void LoadTenderFixture(size_t records, bool portfolio, std::mt19937& random) {
+        if (portfolio) {
+            PortfolioSpec spec = BenchmarkSpec(0, random);
+            spec.tenderCount = records;
+            LoadGeneratedPortfolio(spec);
+            return;
+        }
+        LoadTenders(records);
+    }
+
+    // Input operasi diambil dari registry sehingga berlaku untuk kedua loader
+    std::vector<wxString> CollectAssetIds() {
+        std::vector<wxString> ids;
+        for (Node<Aset>* node = daftarAset.getHead(); node != nullptr; node = node->next) {
+            ids.push_back(GetAssetId(node->data.key));
+        }
+        return ids;
+    }
+
+    std::vector<SubAsset> CollectSubAssets() {
+        std::vector<SubAsset> subAssets;
+        for (Node<SubAssetHandle>* node = daftarSubAset.getHead(); node != nullptr; node = node->next) {
+            subAssets.push_back(subAssetPool.get(node->data));
+        }
+        return subAssets;
+    }
+
+    std::vector<wxString> CollectTenderIds() {
+        std::vector<wxString> ids;
+        for (const TenderProject& tender : queueTenderProjects) {
+            ids.push_back(GetTenderProjectId(tender.key));
+        }
+        return ids;
+    }
+
+    // MEASUREMENT
+
+    // Jalankan operation(i) sampai options.operations kali atau budget habis
+    void Measure(BenchmarkResult& result, const BenchmarkOptions& options,
+        const std::function<void(size_t)>& operation) {
+        result.samples.reserve(options.operations);
+        Clock::time_point caseStart = Clock::now();
+        std::chrono::milliseconds budget(options.budgetMilliseconds);
+
+        for (size_t i = 0; i < options.operations; i++) {
+            Clock::time_point start = Clock::now();
+            operation(i);
+            Clock::time_point end = Clock::now();
+            result.samples.push_back(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+            if (end - caseStart > budget) break;
+        }
+    }
+
+    uint64_t Percentile(const std::vector<uint64_t>& sorted, double percent) {
+        if (sorted.empty()) return 0;
+        size_t rank = static_cast<size_t>(percent / 100.0 * sorted.size() + 0.999999);
+        rank = std::max<size_t>(1, std::min(rank, sorted.size()));
+        return sorted[rank - 1];
+    }
+
+    void PrintResult(BenchmarkResult& result, const BenchmarkOptions& options) {
+        std::vector<uint64_t>& samples = result.samples;
+        std::sort(samples.begin(), samples.end());
+
+        double totalNanoseconds = 0;
+        for (uint64_t sample : samples) totalNanoseconds += static_cast<double>(sample);
+        double opsPerSecond = totalNanoseconds > 0 ? samples.size() * 1e9 / totalNanoseconds : 0;
+        double meanNanoseconds = samples.empty() ? 0 : totalNanoseconds / samples.size();
+
+        if (options.csv) {
+            std::printf("%s,%zu,%zu,%.3f,%.1f,%.1f,%llu,%llu,%llu,%llu,%llu\n",
+                result.name.c_str(), result.records, samples.size(), result.setupMilliseconds,
+                opsPerSecond, meanNanoseconds,
+                (unsigned long long)Percentile(samples, 50), (unsigned long long)Percentile(samples, 90),
+                (unsigned long long)Percentile(samples, 99), (unsigned long long)Percentile(samples, 99.9),
+                (unsigned long long)(samples.empty() ? 0 : samples.back()));
+        }
+        else {
+            std::printf("{\"benchmark\":\"%s\",\"records\":%zu,\"ops\":%zu,\"setup_ms\":%.3f,"
+                "\"ops_per_sec\":%.1f,\"mean_ns\":%.1f,\"p50_ns\":%llu,\"p90_ns\":%llu,"
+                "\"p99_ns\":%llu,\"p999_ns\":%llu,\"max_ns\":%llu}\n",
+                result.name.c_str(), result.records, samples.size(), result.setupMilliseconds,
+                opsPerSecond, meanNanoseconds,
+                (unsigned long long)Percentile(samples, 50), (unsigned long long)Percentile(samples, 90),
+                (unsigned long long)Percentile(samples, 99), (unsigned long long)Percentile(samples, 99.9),
+                (unsigned long long)(samples.empty() ? 0 : samples.back()));
+        }
+        std::fflush(stdout);
+    }
+
+    // BENCHMARK CASES
+    // setup mengisi registry dan input operasi, lalu mengembalikan operasi yang diukur
+
+    typedef std::function<std::function<void(size_t)>(size_t records, size_t operations,
+        std::mt19937& random, bool portfolio)> CaseSetup;
+
+    struct BenchmarkCase {
+        const char* name;
+        CaseSetup setup;
+    };
+
+    std::vector<BenchmarkCase> BuildCases() {
+        std::vector<BenchmarkCase> cases;
+
+        cases.push_back({ "AddAsset", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadAssetFixture(records, portfolio, random);
+            auto ids = std::make_shared<std::vector<wxString>>();
+            for (size_t i = 0; i < operations; i++) {
+                ids->push_back(wxString::Format("N%07zu", i + 1));
+            }
+            return std::function<void(size_t)>([ids](size_t i) {
+                AddAsset((*ids)[i], "Aset Baru", "Kost");
+            });
+        } });
+
+        cases.push_back({ "DeleteAsset", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadAssetFixture(records, portfolio, random);
+            auto ids = std::make_shared<std::vector<wxString>>(CollectAssetIds());
+            std::shuffle(ids->begin(), ids->end(), random);
+            ids->resize(std::min(operations, ids->size()));
+            return std::function<void(size_t)>([ids](size_t i) {
+                DeleteAsset((*ids)[i % ids->size()]);
+            });
+        } });
+
+        cases.push_back({ "SearchAssets", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadAssetFixture(records, portfolio, random);
+            auto terms = std::make_shared<std::vector<wxString>>();
+            std::uniform_int_distribution<size_t> pick(0, records - 1);
+            for (int i = 0; i < 64; i++) {
+                terms->push_back(wxString::Format("%zu", pick(random)));
+            }
+            return std::function<void(size_t)>([terms](size_t i) {
+                SearchAssets((*terms)[i % terms->size()]);
+            });
+        } });
+
+        cases.push_back({ "RenameCategory", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadAssetFixture(records, portfolio, random);
+            return std::function<void(size_t)>([](size_t i) {
+                if (i % 2 == 0) RenameCategory("Kost", "Kost Baru");
+                else RenameCategory("Kost Baru", "Kost");
+            });
+        } });
+
+        cases.push_back({ "GenerateUniqueAssetId", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadAssetFixture(records, portfolio, random);
+            return std::function<void(size_t)>([](size_t i) {
+                GenerateUniqueAssetId(CATEGORY_NAMES[i % CATEGORY_COUNT]);
+            });
+        } });
+
+        cases.push_back({ "AddAssetConnection", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadConnectionFixture(records, portfolio, random);
+            std::vector<wxString> assetIds = CollectAssetIds();
+            auto pairs = std::make_shared<std::vector<std::pair<wxString, wxString>>>();
+            std::uniform_int_distribution<size_t> pick(0, assetIds.size() - 1);
+            for (int i = 0; i < 4096; i++) {
+                size_t from = pick(random);
+                size_t to = pick(random);
+                pairs->push_back(std::make_pair(assetIds[from], assetIds[to]));
+            }
+            return std::function<void(size_t)>([pairs](size_t i) {
+                const auto& pair = (*pairs)[i % pairs->size()];
+                AddAssetConnection(pair.first, pair.second, 1);
+            });
+        } });
+
+        cases.push_back({ "ConnectionExists", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadConnectionFixture(records, portfolio, random);
+            std::vector<wxString> assetIds = CollectAssetIds();
+            auto pairs = std::make_shared<std::vector<std::pair<wxString, wxString>>>();
+            std::uniform_int_distribution<size_t> pick(0, assetIds.size() - 1);
+            for (int i = 0; i < 4096; i++) {
+                size_t from = pick(random);
+                size_t to = pick(random);
+                pairs->push_back(std::make_pair(assetIds[from], assetIds[to]));
+            }
+            return std::function<void(size_t)>([pairs](size_t i) {
+                const auto& pair = (*pairs)[i % pairs->size()];
+                ConnectionExists(pair.first, pair.second);
+            });
+        } });
+
+        cases.push_back({ "AssetsInSameCluster", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadConnectionFixture(records, portfolio, random);
+            std::vector<wxString> assetIds = CollectAssetIds();
+            auto pairs = std::make_shared<std::vector<std::pair<wxString, wxString>>>();
+            std::uniform_int_distribution<size_t> pick(0, assetIds.size() - 1);
+            for (int i = 0; i < 4096; i++) {
+                size_t from = pick(random);
+                size_t to = pick(random);
+                pairs->push_back(std::make_pair(assetIds[from], assetIds[to]));
+            }
+            // Bangun cluster di setup; yang diukur query-nya
+            GetLinkedClusterCount();
+            return std::function<void(size_t)>([pairs](size_t i) {
+                const auto& pair = (*pairs)[i % pairs->size()];
+                AssetsInSameCluster(pair.first, pair.second);
+            });
+        } });
+
+        cases.push_back({ "ComputeMinimumSpanningForest", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadConnectionFixture(records, portfolio, random);
+            return std::function<void(size_t)>([](size_t i) {
+                ComputeMinimumSpanningForest();
+            });
+        } });
+
+        cases.push_back({ "GetAssetClusters/10", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadConnectionFixture(records, portfolio, random);
+            GetLinkedClusterCount();
+            return std::function<void(size_t)>([](size_t i) {
+                GetAssetClusters(10);
+            });
+        } });
+
+        cases.push_back({ "AddSubAsset", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadSubAssetFixture(records, portfolio, random);
+            auto subAssets = std::make_shared<std::vector<SubAsset>>(CollectSubAssets());
+            return std::function<void(size_t)>([subAssets](size_t i) {
+                // Anak dari sub-aset yang sudah ada, di pohon aset yang sama
+                const SubAsset& parent = (*subAssets)[(i * 7919) % subAssets->size()];
+                AddSubAsset(GetAssetId(parent.parentKey), GetSubAssetId(parent.key), "Unit Baru", "");
+            });
+        } });
+
+        cases.push_back({ "DeleteSubAsset", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadSubAssetFixture(records, portfolio, random);
+            auto ids = std::make_shared<std::vector<wxString>>();
+            for (const SubAsset& subAsset : CollectSubAssets()) ids->push_back(GetSubAssetId(subAsset.key));
+            std::shuffle(ids->begin(), ids->end(), random);
+            return std::function<void(size_t)>([ids](size_t i) {
+                DeleteSubAsset((*ids)[i % ids->size()]);
+            });
+        } });
+
+        cases.push_back({ "MoveSubAsset", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadSubAssetFixture(records, portfolio, random);
+            // Pindah ke bawah sub-aset acak (sering di tree aset lain)
+            auto moves = std::make_shared<std::vector<std::pair<wxString, SubAsset>>>();
+            std::vector<SubAsset> subAssets = CollectSubAssets();
+            std::uniform_int_distribution<size_t> pick(0, subAssets.size() - 1);
+            for (int i = 0; i < 4096; i++) {
+                moves->push_back(std::make_pair(GetSubAssetId(subAssets[pick(random)].key), subAssets[pick(random)]));
+            }
+            return std::function<void(size_t)>([moves](size_t i) {
+                const auto& move = (*moves)[i % moves->size()];
+                MoveSubAsset(move.first, GetAssetId(move.second.parentKey), GetSubAssetId(move.second.key));
+            });
+        } });
+
+        cases.push_back({ "MoveSubAssets/256", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadSubAssetFixture(records, portfolio, random);
+            auto moves = std::make_shared<std::vector<SubAssetMove>>();
+            std::vector<SubAsset> subAssets = CollectSubAssets();
+            std::uniform_int_distribution<size_t> pick(0, subAssets.size() - 1);
+            for (int i = 0; i < 4096; i++) {
+                const SubAsset& target = subAssets[pick(random)];
+                moves->push_back(SubAssetMove{ subAssets[pick(random)].key, target.parentKey, target.key });
+            }
+            return std::function<void(size_t)>([moves](size_t i) {
+                size_t start = (i * 256) % moves->size();
+                MoveSubAssets(std::vector<SubAssetMove>(moves->begin() + start, moves->begin() + start + 256));
+            });
+        } });
+
+        cases.push_back({ "IsSubAssetUnder", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadSubAssetFixture(records, portfolio, random);
+            // Pasangan (sub-aset, ancestor-nya atau node acak di tree yang sama)
+            auto pairs = std::make_shared<std::vector<std::pair<EntityKey, EntityKey>>>();
+            std::vector<SubAsset> subAssets = CollectSubAssets();
+            std::uniform_int_distribution<size_t> pick(0, subAssets.size() - 1);
+            for (int i = 0; i < 4096; i++) {
+                const SubAsset& subAsset = subAssets[pick(random)];
+                TreeNode<SubAssetHandle>* other = subAssetIndex.FindTreeNode(subAsset.key);
+                if (!other) continue;
+                if (random() % 2) {
+                    while (other->parent && random() % 2) other = other->parent;
+                }
+                else {
+                    AssetTree<SubAssetHandle>* tree = findAssetTree(subAsset.parentKey);
+                    ArrayView<TreeNode<SubAssetHandle>*> nodes = tree->getSubtree(tree->getRoot());
+                    other = nodes[random() % nodes.size()];
+                }
+                pairs->push_back(std::make_pair(subAsset.key, subAssetPool.get(other->data).key));
+            }
+            return std::function<void(size_t)>([pairs](size_t i) {
+                const auto& pair = (*pairs)[i % pairs->size()];
+                IsSubAssetUnder(pair.first, pair.second);
+            });
+        } });
+
+        cases.push_back({ "FindVacantSubAssets", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadSubAssetFixture(records, portfolio, random);
+            auto starts = std::make_shared<std::vector<LedgerDay>>();
+            std::uniform_int_distribution<LedgerDay> pick(LedgerDayFromDate(2024, 1, 1), LedgerDayFromDate(2026, 9, 1));
+            for (int i = 0; i < 4096; i++) starts->push_back(pick(random));
+            return std::function<void(size_t)>([starts](size_t i) {
+                LedgerDay start = (*starts)[i % starts->size()];
+                FindVacantSubAssets(start, start + 30);
+            });
+        } });
+
+        cases.push_back({ "LeaseOverlapQuery", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadSubAssetFixture(records, portfolio, random);
+            auto starts = std::make_shared<std::vector<LedgerDay>>();
+            std::uniform_int_distribution<LedgerDay> pick(LedgerDayFromDate(2024, 1, 1), LedgerDayFromDate(2026, 9, 1));
+            for (int i = 0; i < 4096; i++) starts->push_back(pick(random));
+            return std::function<void(size_t)>([starts](size_t i) {
+                LedgerDay start = (*starts)[i % starts->size()];
+                rentalLedger.FindOverlapping(start, start + 1);
+            });
+        } });
+
+        cases.push_back({ "ComputeMonthlyOccupancy/12", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadSubAssetFixture(records, portfolio, random);
+            return std::function<void(size_t)>([](size_t) {
+                ComputeMonthlyOccupancy(2025, 10, 12);
+            });
+        } });
+
+        cases.push_back({ "RunMonthlyBilling", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadSubAssetFixture(records, portfolio, random);
+            auto pool = std::make_shared<WorkerPool>();
+            return std::function<void(size_t)>([pool](size_t i) {
+                RunMonthlyBilling(2025, 1 + static_cast<int>(i % 12), pool.get());
+            });
+        } });
+
+        cases.push_back({ "BuildTreeDisplayRows", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadSubAssetFixture(records, portfolio, random);
+            return std::function<void(size_t)>([](size_t) {
+                BuildTreeDisplayRows();
+            });
+        } });
+
+        cases.push_back({ "AddToAssetHistory", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadAssetFixture(records, portfolio, random);
+            std::vector<wxString> assetIds = CollectAssetIds();
+            auto ids = std::make_shared<std::vector<wxString>>();
+            std::uniform_int_distribution<size_t> pick(0, assetIds.size() - 1);
+            for (int i = 0; i < 4096; i++) ids->push_back(assetIds[pick(random)]);
+            return std::function<void(size_t)>([ids](size_t i) {
+                AddToAssetHistory((*ids)[i % ids->size()], "Aset", "Asset");
+            });
+        } });
+
+        cases.push_back({ "TenderEnqueue", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadTenderFixture(records, portfolio, random);
+            return std::function<void(size_t)>([](size_t) {
+                AddTenderProject("Proyek Baru", "Gedung", "", "01/01/2025", 500000, "Klien", 2);
+            });
+        } });
+
+        cases.push_back({ "TenderRemove", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadTenderFixture(records, portfolio, random);
+            auto ids = std::make_shared<std::vector<wxString>>(CollectTenderIds());
+            std::shuffle(ids->begin(), ids->end(), random);
+            return std::function<void(size_t)>([ids](size_t i) {
+                DeleteTenderProject((*ids)[i % ids->size()]);
+            });
+        } });
+
+        cases.push_back({ "ComputeStatistics", [](size_t records, size_t operations, std::mt19937& random, bool portfolio) {
+            LoadAssetFixture(records, portfolio, random);
+            return std::function<void(size_t)>([](size_t) {
+                ComputeStatistics();
+            });
+        } });
+
+        return cases;
+    }
+
+    bool ParseOptions(int argc, char** argv, BenchmarkOptions& options) {
+        options.sizes = { 1000, 10000, 100000, 1000000 };
+        options.operations = 1000;
+        options.budgetMilliseconds = 2000;
+        options.seed = 42;
+        options.csv = false;
+        options.portfolio = false;
+
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            std::string value = arg.find('=') != std::string::npos ? arg.substr(arg.find('=') + 1) : "";
+
+            if (arg.compare(0, 8, "--sizes=") == 0) {
+                options.sizes.clear();
+                size_t start = 0;
+                while (start < value.size()) {
+                    size_t comma = value.find(',', start);
+                    if (comma == std::string::npos) comma = value.size();
+                    options.sizes.push_back(static_cast<size_t>(std::strtod(value.substr(start, comma - start).c_str(), nullptr)));
+                    start = comma + 1;
+                }
+            }
+            else if (arg.compare(0, 6, "--ops=") == 0) {
+                options.operations = static_cast<size_t>(std::strtoul(value.c_str(), nullptr, 10));
+            }
+            else if (arg.compare(0, 12, "--budget-ms=") == 0) {
+                options.budgetMilliseconds = std::strtol(value.c_str(), nullptr, 10);
+            }
+            else if (arg.compare(0, 7, "--seed=") == 0) {
+                options.seed = static_cast<unsigned>(std::strtoul(value.c_str(), nullptr, 10));
+            }
+            else if (arg.compare(0, 9, "--filter=") == 0) {
+                options.filter = value;
+            }
+            else if (arg == "--format=csv") {
+                options.csv = true;
+            }
+            else if (arg == "--format=json") {
+                options.csv = false;
+            }
+            else if (arg == "--portfolio") {
+                options.portfolio = true;
+            }
+            else if (arg.compare(0, 8, "--trace=") == 0) {
+                options.tracePath = value;
+            }
+            else {
+                std::fprintf(stderr,
+                    "Pemakaian: %s [--sizes=1000,1e4,...] [--ops=N] [--budget-ms=N]\n"
+                    "           [--seed=N] [--filter=nama] [--format=json|csv] [--portfolio]\n"
+                    "           [--trace=file.json]\n", argv[0]);
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    wxInitializer initializer;
+    if (!initializer.IsOk()) {
+        std::fprintf(stderr, "Gagal inisialisasi wxWidgets\n");
+        return 1;
+    }
+
+    BenchmarkOptions options;
+    if (!ParseOptions(argc, argv, options)) return 2;
+
+    if (!options.tracePath.empty()) {
+        SetTraceThreadName("Benchmark");
+        StartTracing();
+    }
+
+    if (options.csv) {
+        std::printf("benchmark,records,ops,setup_ms,ops_per_sec,mean_ns,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n");
+    }
+
+    std::vector<BenchmarkCase> cases = BuildCases();
+    for (const auto& benchmarkCase : cases) {
+        if (!options.filter.empty() && std::string(benchmarkCase.name).find(options.filter) == std::string::npos) {
+            continue;
+        }
+
+        for (size_t records : options.sizes) {
+            if (records == 0) continue;
+
+            // Seed sama per kasus sehingga input identik antar run dan commit
+            std::mt19937 random(options.seed);
+            ResetRegistry();
+
+            BenchmarkResult result;
+            result.name = benchmarkCase.name;
+            result.records = records;
+
+            Clock::time_point setupStart = Clock::now();
+            std::function<void(size_t)> operation = benchmarkCase.setup(records, options.operations, random,
+                options.portfolio);
+            result.setupMilliseconds = ElapsedMilliseconds(setupStart);
+
+            Measure(result, options, operation);
+            PrintResult(result, options);
+        }
+    }
+
+    ResetRegistry();
+
+    if (!options.tracePath.empty()) {
+        StopTracing();
+        if (!WriteChromeTrace(options.tracePath)) {
+            std::fprintf(stderr, "Gagal menulis trace ke %s\n", options.tracePath.c_str());
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include "AssetClusters.h"
+#include "AssetEngine.h"
+#include "PerfMetrics.h"
+#include <algorithm>
+
+// rootSlots untuk key yang bukan wakil cluster berisi >= 2 aset
+static const uint32_t NO_SLOT = 0xFFFFFFFFu;
+
+void AssetClusters::AddConnection(EntityKey from, EntityKey to) {
+    // Cluster kotor ikut memuat koneksi ini saat dibangun ulang
+    if (dirty.load(std::memory_order_acquire)) return;
+    if (isAlive(from) && isAlive(to)) link(from, to);
+}
+
+void AssetClusters::AddAsset(EntityKey key) {
+    // Cluster kotor memuat aset ini dari daftarAset saat dibangun ulang
+    if (dirty.load(std::memory_order_acquire)) return;
+    size_t count = static_cast<size_t>(key) + 1;
+    sets.grow(count);
+    if (rootSlots.size() < count) rootSlots.resize(count, NO_SLOT);
+    if (alive.size() < count) alive.resize(count, false);
+    alive[key] = true;
+}
+
+// Gabungkan dua cluster; daftar wakil cluster diperbarui O(1)
+void AssetClusters::link(EntityKey from, EntityKey to) const {
+    EntityKey high = std::max(from, to);
+    if (high >= rootSlots.size()) rootSlots.resize(static_cast<size_t>(high) + 1, NO_SLOT);
+    EntityKey a = sets.find(from);
+    EntityKey b = sets.find(to);
+    if (a == b) return;
+
+    for (EntityKey root : { a, b }) {
+        uint32_t slot = rootSlots[root];
+        if (slot == NO_SLOT) continue;
+        EntityKey last = linkedRoots.back();
+        linkedRoots[slot] = last;
+        rootSlots[last] = slot;
+        linkedRoots.pop_back();
+        rootSlots[root] = NO_SLOT;
+    }
+    sets.unite(a, b);
+    EntityKey root = sets.find(a);
+    rootSlots[root] = static_cast<uint32_t>(linkedRoots.size());
+    linkedRoots.push_back(root);
+}
+
+void AssetClusters::ensureBuilt() const {
+    if (!dirty.load(std::memory_order_acquire)) return;
+    std::lock_guard<std::mutex> lock(rebuildMutex);
+    if (!dirty.load(std::memory_order_relaxed)) return;
+    PERF_SCOPE("AssetClusters::Rebuild");
+
+    sets.clear();
+    sets.grow(assetKeys.size());
+    linkedRoots.clear();
+    rootSlots.assign(assetKeys.size(), NO_SLOT);
+    alive.assign(assetKeys.size(), false);
+    for (const auto& aset : daftarAset) {
+        alive[aset.key] = true;
+    }
+    // Koneksi ke aset yang sudah dihapus dilewati, seperti di graph dan jaringan minimum
+    for (const AssetConnection& connection : connections.view()) {
+        if (isAlive(connection.fromAssetKey) && isAlive(connection.toAssetKey)) {
+            link(connection.fromAssetKey, connection.toAssetKey);
+        }
+    }
+    // Setelah flatten, pembaca menemukan root dalam satu langkah
+    sets.flatten();
+    dirty.store(false, std::memory_order_release);
+}
+
+bool AssetClusters::SameCluster(EntityKey a, EntityKey b) const {
+    ensureBuilt();
+    return sets.findRoot(a) == sets.findRoot(b);
+}
+
+EntityKey AssetClusters::GetClusterRoot(EntityKey key) const {
+    ensureBuilt();
+    return sets.findRoot(key);
+}
+
+uint32_t AssetClusters::GetClusterSize(EntityKey key) const {
+    ensureBuilt();
+    return sets.setSize(key);
+}
+
+const std::vector<EntityKey>& AssetClusters::GetLinkedRoots() const {
+    ensureBuilt();
+    return linkedRoots;
+}
+
+size_t AssetClusters::GetOverheadBytes() const {
+    return sets.getMemoryBytes() + linkedRoots.capacity() * sizeof(EntityKey) +
+        rootSlots.capacity() * sizeof(uint32_t) + alive.capacity() / 8;
+}
+
+void AssetClusters::clear() {
+    sets.clear();
+    std::vector<EntityKey>().swap(linkedRoots);
+    std::vector<uint32_t>().swap(rootSlots);
+    std::vector<bool>().swap(alive);
+    dirty.store(true, std::memory_order_release);
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "DataStructures.h"
+#include "EntityKeys.h"
+
+// Cluster aset: aset yang terhubung langsung atau lewat aset lain di
+// daftarKoneksiAset, sebagai union-find atas key aset. Koneksi baru langsung
+// digabung (O(α)); koneksi yang dihapus tidak bisa "dipisah", jadi cluster
+// ditandai kotor dan dibangun ulang sekali oleh query berikutnya. Hanya aset
+// yang masih ada di daftarAset yang dihitung. Aset dengan key baru cukup
+// ditambah sebagai singleton; hapus aset atau ID yang dipakai ulang (bisa
+// menghidupkan koneksi lama) menandai cluster kotor.
+//
+// Diubah hanya di bawah write lock DATA_KONEKSI. Query boleh dipanggil
+// beberapa pembaca sekaligus di bawah RegistryReadLock: pembaca tidak
+// memampatkan path, dan pembangunan ulang dijaga mutex seperti urutan
+// preorder AssetTree.
+
+struct AssetConnection;
+
+struct AssetCluster {
+    EntityKey rootKey;          // wakil cluster, salah satu anggotanya
+    uint32_t size;              // jumlah aset
+};
+
+class AssetClusters {
+public:
+    explicit AssetClusters(const LinkedList<AssetConnection>& connections)
+        : connections(connections), dirty(true) {
+    }
+
+    // Koneksi from-to baru saja ditambahkan
+    void AddConnection(EntityKey from, EntityKey to);
+    // Aset baru dengan key yang belum pernah di-intern, jadi belum punya koneksi
+    void AddAsset(EntityKey key);
+    // Koneksi atau aset dihapus, ID lama dipakai lagi, atau daftar koneksi diganti seluruhnya
+    void Invalidate() { dirty.store(true, std::memory_order_release); }
+
+    bool SameCluster(EntityKey a, EntityKey b) const;
+    // Wakil cluster (sama untuk semua anggotanya); key itu sendiri jika terisolasi
+    EntityKey GetClusterRoot(EntityKey key) const;
+    uint32_t GetClusterSize(EntityKey key) const;
+    // Wakil semua cluster dengan >= 2 aset, urutan tidak ditentukan; O(1)
+    const std::vector<EntityKey>& GetLinkedRoots() const;
+
+    size_t GetOverheadBytes() const;
+    void clear();
+
+private:
+    void ensureBuilt() const;
+    void link(EntityKey from, EntityKey to) const;
+    bool isAlive(EntityKey key) const { return key < alive.size() && alive[key]; }
+
+    const LinkedList<AssetConnection>& connections;
+    mutable DisjointSet sets;
+    mutable std::vector<EntityKey> linkedRoots;
+    mutable std::vector<uint32_t> rootSlots;   // key root -> posisi di linkedRoots
+    mutable std::vector<bool> alive;            // key aset yang ada di daftarAset saat dibangun
+    mutable std::atomic<bool> dirty;
+    mutable std::mutex rebuildMutex;
+};
@@ -0,0 +1,1376 @@
+#include "AssetEngine.h"
+#include "ForceLayout.h"
+#include "PerfMetrics.h"
+#include "WorkerPool.h"
+#include <wx/datetime.h>
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+// GLOBAL QUEUE FOR TENDER PROJECTS
+Queue<TenderProject> queueTenderProjects;
+
+Stack<AssetHistory> assetHistoryStack(15); 
+
+ObjectPool<SubAsset> subAssetPool;
+LinkedList<SubAssetHandle> daftarSubAset;
+LinkedList<AssetTree<SubAssetHandle>*> assetTrees;
+SubAssetIndex subAssetIndex(subAssetPool);
+RentalLedger rentalLedger;
+
+// Global data structures
+EntityKeyMap assetKeys;
+EntityKeyMap subAssetKeys;
+EntityKeyMap tenderKeys;
+
+CategoryDictionary daftarKategori;
+LinkedList<Aset> daftarAset;
+LinkedList<AssetValueDetails> daftarDetailNilaiAset;
+LinkedList<AssetConnection> daftarKoneksiAset;
+AssetClusters assetClusters(daftarKoneksiAset);
+
+// DATA GENERATIONS
+unsigned long dataGeneration[DATA_DOMAIN_COUNT] = {};
+
+void BumpDataGeneration(unsigned domains) {
+    for (int i = 0; i < DATA_DOMAIN_COUNT; i++) {
+        if (domains & (1u << i)) dataGeneration[i]++;
+    }
+}
+
+unsigned long GetDataStamp(unsigned domains) {
+    unsigned long stamp = 0;
+    for (int i = 0; i < DATA_DOMAIN_COUNT; i++) {
+        if (domains & (1u << i)) stamp += dataGeneration[i];
+    }
+    return stamp;
+}
+
+// REGISTRY LOCK
+std::shared_mutex registryMutex;
+std::atomic<unsigned long> registryGeneration(0);
+
+// Helper functions
+Node<CategoryCount>* findCategoryNode(LinkedList<CategoryCount>& counts, const wxString& key) {
+    Node<CategoryCount>* current = counts.getHead();
+    while (current) {
+        if (current->data.kategori == key) {
+            return current;
+        }
+        current = current->next;
+    }
+    return nullptr;
+}
+
+void initializeCategoryCounts(const CategoryDictionary& daftarKategori, LinkedList<CategoryCount>& counts) {
+    for (const Kategori& kategori : daftarKategori) {
+        counts.push_back(CategoryCount(kategori.nama, 0));
+    }
+}
+
+void countAssetsByCategory(const CategoryDictionary& daftarKategori, LinkedList<CategoryCount>& counts) {
+    for (const Kategori& kategori : daftarKategori) {
+        Node<CategoryCount>* node = findCategoryNode(counts, kategori.nama);
+        if (node) {
+            node->data.count += static_cast<int>(kategori.assets.size());
+        }
+    }
+}
+
+Node<AssetValueDetails>* findAssetValueById(LinkedList<AssetValueDetails>& list, const wxString& id) {
+    EntityKey key;
+    if (!assetKeys.Find(id, key)) return nullptr;
+    return findAssetValueByKey(list, key);
+}
+
+Node<AssetValueDetails>* findAssetValueByKey(LinkedList<AssetValueDetails>& list, EntityKey assetKey) {
+    Node<AssetValueDetails>* current = list.getHead();
+    while (current) {
+        if (current->data.assetKey == assetKey) {
+            return current;
+        }
+        current = current->next;
+    }
+    return nullptr;
+}
+
+void addOrUpdateAssetValue(LinkedList<AssetValueDetails>& list, EntityKey assetKey, int currentValue, int maintenanceCost, int propertyTax) {
+    Node<AssetValueDetails>* node = findAssetValueByKey(list, assetKey);
+    if (node) {
+        node->data.currentValue = currentValue;
+        node->data.maintenanceCost = maintenanceCost;
+        node->data.propertyTax = propertyTax;
+    }
+    else {
+        list.emplace_back(assetKey, currentValue, maintenanceCost, propertyTax);
+    }
+}
+
+void initializeAssetValues(const LinkedList<Aset>& daftarAset, LinkedList<AssetValueDetails>& daftarDetailNilaiAset) {
+    std::vector<bool> hasValue(assetKeys.size(), false);
+    for (Node<AssetValueDetails>* value = daftarDetailNilaiAset.getHead(); value; value = value->next) {
+        if (value->data.assetKey < hasValue.size()) hasValue[value->data.assetKey] = true;
+    }
+
+    std::vector<EntityKey> missingKeys;
+    for (Node<Aset>* current = daftarAset.getHead(); current; current = current->next) {
+        if (!hasValue[current->data.key]) {
+            missingKeys.push_back(current->data.key);
+        }
+    }
+
+    // Lock (dan generation baru) hanya jika memang ada yang ditambahkan
+    if (missingKeys.empty()) return;
+
+    RegistryWriteLock lock(DATA_NILAI_ASET);
+    for (EntityKey key : missingKeys) {
+        daftarDetailNilaiAset.emplace_back(key, 1000, 0, 0);
+    }
+}
+
+void printCategoryCounts(const LinkedList<CategoryCount>& counts) {
+    Node<CategoryCount>* current = counts.getHead();
+    while (current) {
+        wxPrintf("Category: %s, Count: %d\n", current->data.kategori, current->data.count);
+        current = current->next;
+    }
+}
+
+void InitializeDefaultData() {
+    if (daftarKategori.empty()) {
+        daftarKategori.Add("Kost");
+        daftarKategori.Add("Gedung");
+        daftarKategori.Add("Rumah");
+        daftarKategori.Add("Emas");
+        daftarKategori.Add("Kendaraan");
+        daftarKategori.Add("Elektronik");
+    }
+}
+
+void ClearAllData() {
+    TRACE_SCOPE("ClearAllData");
+    RegistryWriteLock lock(DATA_KATEGORI | DATA_ASET | DATA_NILAI_ASET |
+        DATA_KONEKSI | DATA_SUB_ASET | DATA_HISTORY | DATA_TENDER);
+    for (AssetTree<SubAssetHandle>* tree : assetTrees) {
+        delete tree;
+    }
+    assetTrees.clear();
+    daftarSubAset.clear();
+    subAssetIndex.clear();
+    subAssetPool.clear();
+    rentalLedger.clear();
+    daftarKoneksiAset.clear();
+    assetClusters.clear();
+    daftarDetailNilaiAset.clear();
+    daftarAset.clear();
+    daftarKategori.clear();
+    queueTenderProjects.clear();
+    assetHistoryStack.clear();
+    assetKeys.clear();
+    subAssetKeys.clear();
+    tenderKeys.clear();
+}
+
+wxString GenerateUniqueAssetId(const wxString& type) {
+    TRACE_SCOPE("GenerateUniqueAssetId");
+    std::string prefix = type.SubString(0, 1).Upper().ToStdString();
+
+    int count = 0;
+    std::vector<bool> live(assetKeys.size(), false);
+    for (const auto& aset : daftarAset) {
+        live[aset.key] = true;
+        if (assetKeys.GetUtf8(aset.key).compare(0, prefix.size(), prefix) == 0) {
+            count++;
+        }
+    }
+
+    // Setelah ada yang dihapus, nomor berikutnya bisa sudah dipakai aset
+    // lain; lewati ID yang masih hidup
+    for (;;) {
+        count++; // next ID
+        std::ostringstream oss;
+        oss << prefix << std::setw(4) << std::setfill('0') << count;
+        wxString id(oss.str());
+        EntityKey existing;
+        if (!assetKeys.Find(id, existing) || !live[existing]) return id;
+    }
+}
+
+std::vector<wxString> GetCategoriesVector() {
+    std::vector<wxString> categories;
+    for (const auto& kategori : daftarKategori) {
+        categories.push_back(kategori.nama.ToWxString());
+    }
+    return categories;
+}
+
+bool CategoryExists(const wxString& category) {
+    CategoryId id;
+    return daftarKategori.Find(category, id);
+}
+
+void AddCategory(const wxString& categoryName) {
+    TRACE_SCOPE("AddCategory");
+    RegistryWriteLock lock(DATA_KATEGORI);
+    daftarKategori.Add(categoryName);
+}
+
+bool RenameCategory(const wxString& oldName, const wxString& newName) {
+    TRACE_SCOPE("RenameCategory");
+    // Nama kategori tampil di daftar aset dan hasil pencarian
+    RegistryWriteLock lock(DATA_KATEGORI | DATA_ASET);
+    CategoryId id;
+    if (!daftarKategori.Find(oldName, id) || !daftarKategori.Rename(id, newName)) {
+        lock.MarkUnchanged();
+        return false;
+    }
+    return true;
+}
+
+wxString GetCategoryName(CategoryId id) {
+    return daftarKategori.GetName(id);
+}
+
+// Tree dan sub-aset milik aset yang dihapus ikut dilepas (dipanggil di dalam write lock).
+// removed: flag per key aset
+void releaseSubAssetsOf(const std::vector<bool>& removed) {
+    auto isRemoved = [&removed](EntityKey key) { return key < removed.size() && removed[key]; };
+    LedgerDay today = LedgerToday();
+
+    Node<AssetTree<SubAssetHandle>*>* current = assetTrees.getHead();
+    while (current) {
+        Node<AssetTree<SubAssetHandle>*>* next = current->next;
+        TreeNode<SubAssetHandle>* root = current->data->getRoot();
+        if (root && isRemoved(subAssetPool.get(root->data).parentKey)) {
+            // Sewa berakhir hari ini, sama seperti DeleteSubAsset
+            AssetTree<SubAssetHandle>::walk(root, [today](TreeNode<SubAssetHandle>* node, int) {
+                rentalLedger.ReleaseUnit(subAssetPool.get(node->data).key, today);
+                });
+            subAssetIndex.DetachTree(current->data);
+            subAssetPool.destroy(root->data);
+            delete current->data;
+            assetTrees.erase(current);
+        }
+        current = next;
+    }
+
+    Node<SubAssetHandle>* subAsset = daftarSubAset.getHead();
+    while (subAsset) {
+        Node<SubAssetHandle>* next = subAsset->next;
+        if (isRemoved(subAssetPool.get(subAsset->data).parentKey)) {
+            rentalLedger.ReleaseUnit(subAssetPool.get(subAsset->data).key, today);
+            subAssetIndex.DetachListNode(subAsset);
+            subAssetPool.destroy(subAsset->data);
+            daftarSubAset.erase(subAsset);
+        }
+        subAsset = next;
+    }
+}
+
+CategoryDeletePlan PlanDeleteCategory(const wxString& categoryName, TaskContext* context) {
+    PERF_SCOPE("DeleteCategory/plan");
+    CategoryDeletePlan plan;
+    plan.categoryName = categoryName;
+    plan.generation = registryGeneration;
+    plan.cancelled = false;
+
+    if (!daftarKategori.Find(categoryName, plan.categoryId)) {
+        plan.categoryId = NO_CATEGORY;
+        return plan;
+    }
+
+    // Assets with this category langsung dari index kategori, tanpa scan daftarAset
+    plan.assets = daftarKategori.GetAssets(plan.categoryId);
+    std::vector<bool> removed(assetKeys.size(), false);
+    for (Node<Aset>* node : plan.assets) {
+        removed[node->data.key] = true;
+    }
+
+    size_t total = context ? daftarDetailNilaiAset.size() : 0;
+    size_t index = 0;
+
+    // Value details of those assets, cukup cek flag per key
+    for (Node<AssetValueDetails>* current = daftarDetailNilaiAset.getHead(); current; current = current->next) {
+        if (context && (++index % TASK_CHECK_INTERVAL) == 0) {
+            if (context->IsCancelled()) { plan.cancelled = true; return plan; }
+            context->ReportProgress(static_cast<int>(index * 100 / total));
+        }
+        if (current->data.assetKey < removed.size() && removed[current->data.assetKey]) {
+            plan.values.push_back(current);
+        }
+    }
+
+    PERF_COUNT("DeleteCategory/aset", plan.assets.size());
+    return plan;
+}
+
+// Mengembalikan false jika registry berubah sejak plan dibuat (plan harus dibuat ulang)
+bool ApplyDeleteCategory(const CategoryDeletePlan& plan) {
+    PERF_SCOPE("DeleteCategory/apply");
+    RegistryWriteLock lock(DATA_KATEGORI | DATA_ASET | DATA_NILAI_ASET | DATA_SUB_ASET);
+    if (plan.cancelled || plan.generation != registryGeneration) {
+        lock.MarkUnchanged();
+        return false;
+    }
+
+    std::vector<bool> removed(assetKeys.size(), false);
+    for (Node<Aset>* node : plan.assets) {
+        removed[node->data.key] = true;
+        daftarAset.erase(node);
+    }
+    releaseSubAssetsOf(removed);
+    assetClusters.Invalidate();
+    for (Node<AssetValueDetails>* node : plan.values) {
+        daftarDetailNilaiAset.erase(node);
+    }
+
+    // Remove the category (index asetnya ikut dikosongkan)
+    if (plan.categoryId != NO_CATEGORY) {
+        daftarKategori.Remove(plan.categoryId);
+    }
+    return true;
+}
+
+void DeleteCategory(const wxString& categoryName) {
+    TRACE_SCOPE("DeleteCategory");
+    ApplyDeleteCategory(PlanDeleteCategory(categoryName));
+}
+
+void AddAsset(const wxString& id, const wxString& nama, const wxString& kategori) {
+    TRACE_SCOPE("AddAsset");
+    CategoryId categoryId;
+    bool knownCategory = daftarKategori.Find(kategori, categoryId);
+    RegistryWriteLock lock(DATA_ASET | DATA_NILAI_ASET | (knownCategory ? 0 : DATA_KATEGORI));
+    if (!knownCategory) {
+        categoryId = daftarKategori.Add(kategori);
+    }
+    EntityKey key;
+    bool reusedId = assetKeys.Find(id, key);
+    if (!reusedId) key = assetKeys.Intern(id);
+    daftarAset.emplace_back(key, nama, categoryId);
+    if (reusedId) {
+        // ID yang dipakai ulang menghidupkan lagi koneksi lamanya
+        assetClusters.Invalidate();
+    }
+    else {
+        // Key baru belum punya koneksi; cukup jadi singleton
+        assetClusters.AddAsset(key);
+    }
+    daftarKategori.AttachAsset(daftarAset.getTail());
+    // Initialize asset value with default values
+    addOrUpdateAssetValue(daftarDetailNilaiAset, key, 1000, 0, 0);
+}
+
+void DeleteAsset(const wxString& assetId) {
+    TRACE_SCOPE("DeleteAsset");
+    EntityKey key;
+    if (!assetKeys.Find(assetId, key)) return;
+
+    RegistryWriteLock lock(DATA_ASET | DATA_NILAI_ASET | DATA_SUB_ASET);
+    daftarAset.remove_if([key](const Aset& a) {
+        if (a.key != key) return false;
+        daftarKategori.DetachAsset(a);
+        return true;
+        });
+    std::vector<bool> removed(assetKeys.size(), false);
+    removed[key] = true;
+    releaseSubAssetsOf(removed);
+    assetClusters.Invalidate();
+
+    // Remove asset value details
+    daftarDetailNilaiAset.remove_if([key](const AssetValueDetails& avd) {
+        return avd.assetKey == key;
+        });
+}
+
+ListView<Aset> GetAssets() {
+    return daftarAset.view();
+}
+
+// context diisi jika dijalankan di worker (cek pembatalan + progress)
+std::vector<Aset> SearchAssets(const wxString& searchTerm, TaskContext* context) {
+    PERF_SCOPE("SearchAssets");
+    std::vector<Aset> results;
+    wxString term = searchTerm.Lower();
+    size_t total = context ? daftarAset.size() : 0;
+    size_t index = 0;
+
+    // Nama kategori dicocokkan sekali per kategori, bukan per aset
+    std::vector<bool> categoryMatches(daftarKategori.GetIdCount(), false);
+    for (size_t id = 0; id < categoryMatches.size(); id++) {
+        categoryMatches[id] = daftarKategori.GetName(static_cast<CategoryId>(id)).Lower().Contains(term);
+    }
+
+    for (const auto& aset : daftarAset) {
+        if (context && (++index % TASK_CHECK_INTERVAL) == 0) {
+            if (context->IsCancelled()) break;
+            context->ReportProgress(static_cast<int>(index * 100 / total));
+        }
+        if (aset.nama.ToWxString().Lower().Contains(term) ||
+            assetKeys.GetId(aset.key).Lower().Contains(term) ||
+            (aset.kategori < categoryMatches.size() && categoryMatches[aset.kategori])) {
+            results.push_back(aset);
+        }
+    }
+    PERF_COUNT("SearchAssets/hasil", results.size());
+    return results;
+}
+
+// Pencarian + nilai aset untuk halaman pencarian; nilai diambil lewat satu
+// index hash, bukan findAssetValueById per hasil.
+std::vector<SearchResultRow> SearchAssetsWithValues(const wxString& searchTerm, TaskContext* context) {
+    TRACE_SCOPE("SearchAssetsWithValues");
+    std::vector<Aset> matches = SearchAssets(searchTerm, context);
+    std::vector<SearchResultRow> rows;
+    if (context && context->IsCancelled()) return rows;
+
+    // Index baris per key aset
+    std::vector<size_t> matchIndex(assetKeys.size(), SIZE_MAX);
+    rows.reserve(matches.size());
+    for (size_t i = 0; i < matches.size(); i++) {
+        matchIndex[matches[i].key] = i;
+        rows.push_back(SearchResultRow{ std::move(matches[i]), false, 0 });
+    }
+
+    for (const auto& value : daftarDetailNilaiAset) {
+        if (value.assetKey >= matchIndex.size()) continue;
+        size_t row = matchIndex[value.assetKey];
+        if (row != SIZE_MAX && !rows[row].hasValue) {
+            rows[row].hasValue = true;
+            rows[row].currentValue = value.currentValue;
+        }
+    }
+    return rows;
+}
+
+StatisticsSnapshot ComputeStatistics(TaskContext* context) {
+    PERF_SCOPE("ComputeStatistics");
+    StatisticsSnapshot snapshot;
+    snapshot.totalAssets = 0;
+    snapshot.hasValueDetails = !daftarDetailNilaiAset.empty();
+    snapshot.totalValue = 0;
+    snapshot.totalMaintenance = 0;
+    snapshot.totalTax = 0;
+    snapshot.totalSubAssets = 0;
+    snapshot.rentedSubAssets = 0;
+    snapshot.totalRentalIncome = 0;
+
+    // Jumlah aset per kategori langsung dari index kategori
+    for (const auto& kategori : daftarKategori) {
+        snapshot.categoryCounts.push_back(CategoryCount(kategori.nama, static_cast<int>(kategori.assets.size())));
+    }
+    snapshot.totalAssets = daftarAset.size();
+
+    // Okupansi sewa dari rollup root tiap tree, tanpa menelusuri node
+    for (AssetTree<SubAssetHandle>* tree : assetTrees) {
+        if (!tree->getRoot()) continue;
+        SubAssetRollup rollup = subAssetIndex.GetRollup(subAssetPool.get(tree->getRoot()->data).key);
+        snapshot.totalSubAssets += rollup.units;
+        snapshot.rentedSubAssets += rollup.rented;
+        snapshot.totalRentalIncome += rollup.income;
+    }
+
+    // 12 bulan terakhir termasuk bulan ini
+    int year, month, day;
+    LedgerDateFromDay(LedgerToday(), year, month, day);
+    month -= 11;
+    if (month < 1) {
+        month += 12;
+        year--;
+    }
+    snapshot.monthlyOccupancy = ComputeMonthlyOccupancy(year, month, 12);
+
+    size_t total = context ? daftarDetailNilaiAset.size() : 0;
+    size_t index = 0;
+
+    for (const auto& value : daftarDetailNilaiAset) {
+        if (context && (++index % TASK_CHECK_INTERVAL) == 0) {
+            if (context->IsCancelled()) return snapshot;
+            context->ReportProgress(static_cast<int>(index * 100 / total));
+        }
+        snapshot.totalValue += value.currentValue;
+        snapshot.totalMaintenance += value.maintenanceCost;
+        snapshot.totalTax += value.propertyTax;
+    }
+    return snapshot;
+}
+
+// MEMORY ACCOUNTING
+
+// Blok heap satu CompactString: header panjang + UTF-8 + terminator + header
+// blok. InternedString tidak punya heap sendiri; teksnya dihitung sekali di
+// entri "String pool".
+size_t stringHeapBytes(const CompactString& text) {
+    if (text.IsEmpty()) return 0;
+    return text.HeapBytes() + HEAP_BLOCK_OVERHEAD;
+}
+
+size_t stringHeapBytes(const InternedString&) {
+    return 0;
+}
+
+size_t recordStringBytes(const Aset& aset) {
+    return stringHeapBytes(aset.nama);
+}
+
+size_t recordStringBytes(const AssetValueDetails&) {
+    return 0;
+}
+
+size_t recordStringBytes(const AssetConnection& connection) {
+    return stringHeapBytes(connection.description);
+}
+
+size_t recordStringBytes(const SubAsset& subAsset) {
+    return stringHeapBytes(subAsset.nama) + stringHeapBytes(subAsset.description) +
+        stringHeapBytes(subAsset.renterName);
+}
+
+size_t recordStringBytes(const TenderProject& project) {
+    return stringHeapBytes(project.nama) +
+        stringHeapBytes(project.kategori) + stringHeapBytes(project.description) +
+        stringHeapBytes(project.status) + stringHeapBytes(project.tenderDate) +
+        stringHeapBytes(project.clientName);
+}
+
+size_t recordStringBytes(const AssetHistory& history) {
+    return stringHeapBytes(history.assetId) + stringHeapBytes(history.assetName) +
+        stringHeapBytes(history.assetType) + stringHeapBytes(history.accessTime);
+}
+
+// List/tree sub-aset hanya memegang handle; string dihitung di pool record
+size_t recordStringBytes(const SubAssetHandle&) {
+    return 0;
+}
+
+size_t recordStringBytes(AssetTree<SubAssetHandle>* const&) {
+    return 0;
+}
+
+// Cek pembatalan dan progress per TASK_CHECK_INTERVAL node
+struct MemoryScan {
+    TaskContext* context;
+    size_t total;
+    size_t index;
+
+    bool Step() {
+        if (!context || (++index % TASK_CHECK_INTERVAL) != 0) return true;
+        if (context->IsCancelled()) return false;
+        context->ReportProgress(static_cast<int>(std::min<size_t>(99, index * 100 / total)));
+        return true;
+    }
+};
+
+// Node dan byte node dari alokator struktur, string dengan menelusuri isinya
+template <typename T, typename Container>
+bool measureStructure(const wxString& name, Container& container, MemoryScan& scan, MemoryReport& report) {
+    const AllocationStats& stats = container.getAllocationStats();
+    StructureMemory memory;
+    memory.name = name;
+    memory.nodes = stats.liveNodes;
+    memory.payloadBytes = stats.liveNodes * sizeof(T);
+    memory.overheadBytes = stats.liveBytes - memory.payloadBytes + stats.liveNodes * HEAP_BLOCK_OVERHEAD;
+    memory.stringBytes = 0;
+
+    for (const T& record : container) {
+        if (!scan.Step()) return false;
+        memory.stringBytes += recordStringBytes(record);
+    }
+    report.structures.push_back(memory);
+    return true;
+}
+
+// Kamus kategori bukan linked list: entri (termasuk yang sudah dihapus),
+// index aset dan hash nama dihitung sebagai overhead
+bool measureCategories(MemoryScan& scan, MemoryReport& report) {
+    StructureMemory memory;
+    memory.name = "Kategori";
+    memory.nodes = daftarKategori.GetIdCount();
+    memory.payloadBytes = 0;
+    memory.overheadBytes = daftarKategori.GetOverheadBytes();
+    memory.stringBytes = 0;
+
+    for (size_t id = 0; id < daftarKategori.GetIdCount(); id++) {
+        if (!scan.Step()) return false;
+        memory.stringBytes += stringHeapBytes(daftarKategori.Get(static_cast<CategoryId>(id)).nama);
+    }
+    report.structures.push_back(memory);
+    return true;
+}
+
+// Teks ID tiap entitas hanya disimpan di map key-nya (satu buffer, tanpa node)
+void measureKeyMap(const wxString& name, const EntityKeyMap& keys, MemoryReport& report) {
+    StructureMemory memory;
+    memory.name = name;
+    memory.nodes = keys.size();
+    memory.payloadBytes = 0;
+    memory.overheadBytes = keys.GetOverheadBytes();
+    memory.stringBytes = keys.GetTextBytes();
+    report.structures.push_back(memory);
+}
+
+// Node tree tinggal di arena tree-nya; slot kosong dan header chunk dihitung sebagai overhead
+bool measureAssetTrees(MemoryScan& scan, MemoryReport& report) {
+    StructureMemory memory;
+    memory.name = "Tree sub-aset";
+    memory.nodes = 0;
+    memory.payloadBytes = 0;
+    memory.overheadBytes = 0;
+    memory.stringBytes = 0;
+
+    for (AssetTree<SubAssetHandle>* tree : assetTrees) {
+        if (!scan.Step()) return false;
+        size_t payload = tree->size() * sizeof(SubAssetHandle);
+        memory.nodes += tree->size();
+        memory.payloadBytes += payload;
+        memory.overheadBytes += sizeof(AssetTree<SubAssetHandle>) + HEAP_BLOCK_OVERHEAD +
+            tree->getArenaBytes() - payload + tree->getChunkCount() * HEAP_BLOCK_OVERHEAD +
+            tree->getOverheadBytes();
+    }
+    report.structures.push_back(memory);
+    return true;
+}
+
+// Record sub-aset tinggal di chunk pool; slot kosong dihitung sebagai overhead
+bool measureSubAssetPool(MemoryScan& scan, MemoryReport& report) {
+    StructureMemory memory;
+    memory.name = "Record sub-aset";
+    memory.nodes = subAssetPool.size();
+    memory.payloadBytes = subAssetPool.size() * sizeof(SubAsset);
+    memory.overheadBytes = subAssetPool.getChunkBytes() - memory.payloadBytes + subAssetPool.getOverheadBytes();
+    memory.stringBytes = 0;
+
+    for (size_t handle = 0; handle < subAssetPool.getSlotCount(); handle++) {
+        if (!subAssetPool.isLive(static_cast<SubAssetHandle>(handle))) continue;
+        if (!scan.Step()) return false;
+        memory.stringBytes += recordStringBytes(subAssetPool.get(static_cast<SubAssetHandle>(handle)));
+    }
+    report.structures.push_back(memory);
+    return true;
+}
+
+MemoryReport ComputeMemoryReport(TaskContext* context) {
+    PERF_SCOPE("ComputeMemoryReport");
+    MemoryReport report;
+    report.totalBytes = 0;
+    report.cancelled = false;
+
+    // Record pool kira-kira sebanyak sub-aset; tree dihitung per tree. Cukup untuk progress
+    MemoryScan scan{ context, 1, 0 };
+    scan.total = std::max<size_t>(1, daftarKategori.GetIdCount() + daftarAset.size() +
+        daftarDetailNilaiAset.size() + daftarKoneksiAset.size() + daftarSubAset.size() * 2 +
+        assetTrees.size() * 2 + queueTenderProjects.size() + assetHistoryStack.size());
+
+    bool complete =
+        measureCategories(scan, report) &&
+        measureStructure<Aset>("Aset", daftarAset, scan, report) &&
+        measureStructure<AssetValueDetails>("Nilai aset", daftarDetailNilaiAset, scan, report) &&
+        measureStructure<AssetConnection>("Koneksi", daftarKoneksiAset, scan, report) &&
+        measureSubAssetPool(scan, report) &&
+        measureStructure<SubAssetHandle>("Sub-aset", daftarSubAset, scan, report) &&
+        measureAssetTrees(scan, report) &&
+        measureStructure<AssetTree<SubAssetHandle>*>("Daftar tree", assetTrees, scan, report) &&
+        measureStructure<TenderProject>("Queue tender", queueTenderProjects, scan, report) &&
+        measureStructure<AssetHistory>("History stack", assetHistoryStack, scan, report);
+
+    // Map key ID dan tabel intern dipakai bersama semua struktur (append-only)
+    if (complete) {
+        measureKeyMap("Key aset", assetKeys, report);
+        measureKeyMap("Key sub-aset", subAssetKeys, report);
+        measureKeyMap("Key tender", tenderKeys, report);
+
+        StructureMemory index;
+        index.name = "Index sub-aset";
+        index.nodes = 0;
+        index.payloadBytes = 0;
+        index.overheadBytes = subAssetIndex.GetOverheadBytes();
+        index.stringBytes = 0;
+        report.structures.push_back(index);
+
+        StructureMemory ledger;
+        ledger.name = "Ledger sewa";
+        ledger.nodes = rentalLedger.size();
+        ledger.payloadBytes = rentalLedger.GetPayloadBytes();
+        ledger.overheadBytes = rentalLedger.GetOverheadBytes();
+        ledger.stringBytes = 0;
+        report.structures.push_back(ledger);
+
+        StructureMemory clusters;
+        clusters.name = "Cluster aset";
+        clusters.nodes = assetClusters.GetLinkedRoots().size();
+        clusters.payloadBytes = 0;
+        clusters.overheadBytes = assetClusters.GetOverheadBytes();
+        clusters.stringBytes = 0;
+        report.structures.push_back(clusters);
+
+        StructureMemory pool;
+        pool.name = "String pool";
+        pool.nodes = stringInterner.GetCount();
+        pool.payloadBytes = 0;
+        pool.overheadBytes = 0;
+        pool.stringBytes = stringInterner.GetMemoryBytes();
+        report.structures.push_back(pool);
+    }
+
+    report.cancelled = !complete;
+    for (const StructureMemory& memory : report.structures) {
+        report.totalBytes += memory.TotalBytes();
+    }
+    return report;
+}
+
+bool ConnectionExists(const wxString& fromId, const wxString& toId) {
+    TRACE_SCOPE("ConnectionExists");
+    // ID yang belum punya key tidak mungkin punya koneksi
+    EntityKey from, to;
+    if (!assetKeys.Find(fromId, from) || !assetKeys.Find(toId, to)) return false;
+    return connectionExists(from, to);
+}
+
+bool connectionExists(EntityKey from, EntityKey to) {
+    Node<AssetConnection>* current = daftarKoneksiAset.getHead();
+    while (current) {
+        if ((current->data.fromAssetKey == from && current->data.toAssetKey == to) ||
+            (current->data.fromAssetKey == to && current->data.toAssetKey == from)) {
+            return true;
+        }
+        current = current->next;
+    }
+    return false;
+}
+
+void AddAssetConnection(const wxString& fromId, const wxString& toId, int weight, const wxString& description) {
+    TRACE_SCOPE("AddAssetConnection");
+    RegistryWriteLock lock(DATA_KONEKSI);
+    EntityKey from = assetKeys.Intern(fromId);
+    EntityKey to = assetKeys.Intern(toId);
+    if (!connectionExists(from, to)) {
+        daftarKoneksiAset.emplace_back(from, to, weight, description);
+        assetClusters.AddConnection(from, to);
+    }
+}
+
+void DeleteAssetConnection(const wxString& fromId, const wxString& toId) {
+    TRACE_SCOPE("DeleteAssetConnection");
+    EntityKey from, to;
+    if (!assetKeys.Find(fromId, from) || !assetKeys.Find(toId, to)) return;
+
+    RegistryWriteLock lock(DATA_KONEKSI);
+    daftarKoneksiAset.remove_if([from, to](const AssetConnection& conn) {
+        return (conn.fromAssetKey == from && conn.toAssetKey == to) ||
+            (conn.fromAssetKey == to && conn.toAssetKey == from);
+        });
+    // Cluster bisa terpecah; dibangun ulang saat query berikutnya
+    assetClusters.Invalidate();
+}
+
+ListView<AssetConnection> GetAssetConnections() {
+    return daftarKoneksiAset.view();
+}
+
+// Snapshot graph koneksi untuk GraphCanvas: node = aset (urutan daftarAset),
+// edge memakai index node. Koneksi ke aset yang sudah tidak ada dilewati.
+void BuildConnectionGraph(std::vector<wxString>& labels, std::vector<LayoutEdge>& edges) {
+    TRACE_SCOPE("BuildConnectionGraph");
+    labels.clear();
+    edges.clear();
+
+    // Index node per key aset; SIZE_MAX = aset tidak ada
+    std::vector<size_t> nodeIndex(assetKeys.size(), SIZE_MAX);
+    for (const auto& aset : daftarAset) {
+        nodeIndex[aset.key] = labels.size();
+        labels.push_back(assetKeys.GetId(aset.key) + " - " + aset.nama);
+    }
+
+    Node<AssetConnection>* current = daftarKoneksiAset.getHead();
+    while (current) {
+        EntityKey from = current->data.fromAssetKey;
+        EntityKey to = current->data.toAssetKey;
+        if (from < nodeIndex.size() && to < nodeIndex.size() &&
+            nodeIndex[from] != SIZE_MAX && nodeIndex[to] != SIZE_MAX) {
+            edges.push_back(LayoutEdge{ nodeIndex[from], nodeIndex[to] });
+        }
+        current = current->next;
+    }
+}
+
+bool AssetsInSameCluster(const wxString& fromId, const wxString& toId) {
+    TRACE_SCOPE("AssetsInSameCluster");
+    EntityKey from, to;
+    if (!assetKeys.Find(fromId, from) || !assetKeys.Find(toId, to)) return false;
+    return assetClusters.SameCluster(from, to);
+}
+
+std::vector<AssetCluster> GetAssetClusters(size_t limit) {
+    TRACE_SCOPE("GetAssetClusters");
+    std::vector<AssetCluster> clusters;
+    const std::vector<EntityKey>& roots = assetClusters.GetLinkedRoots();
+    clusters.reserve(roots.size());
+    for (EntityKey root : roots) {
+        clusters.push_back(AssetCluster{ root, assetClusters.GetClusterSize(root) });
+    }
+    // Urutan stabil untuk ukuran sama: key terkecil dulu
+    auto larger = [](const AssetCluster& a, const AssetCluster& b) {
+        return a.size != b.size ? a.size > b.size : a.rootKey < b.rootKey;
+    };
+    if (clusters.size() > limit) {
+        std::partial_sort(clusters.begin(), clusters.begin() + limit, clusters.end(), larger);
+        clusters.resize(limit);
+    }
+    else {
+        std::sort(clusters.begin(), clusters.end(), larger);
+    }
+    return clusters;
+}
+
+size_t GetLinkedClusterCount() {
+    return assetClusters.GetLinkedRoots().size();
+}
+
+FilteredListView<AssetConnection, ConnectionTouches> GetConnectionsForAsset(const wxString& assetId) {
+    EntityKey key;
+    if (!assetKeys.Find(assetId, key)) {
+        return FilteredListView<AssetConnection, ConnectionTouches>(nullptr, ConnectionTouches{ NO_ENTITY_KEY });
+    }
+    return FilteredListView<AssetConnection, ConnectionTouches>(daftarKoneksiAset.getHead(), ConnectionTouches{ key });
+}
+
+wxString GetAssetNameById(const wxString& assetId) {
+    EntityKey key;
+    if (!assetKeys.Find(assetId, key)) return assetId;
+    return GetAssetNameByKey(key);
+}
+
+wxString GetAssetNameByKey(EntityKey assetKey) {
+    Node<Aset>* current = daftarAset.getHead();
+    while (current) {
+        if (current->data.key == assetKey) {
+            return current->data.nama;
+        }
+        current = current->next;
+    }
+    return GetAssetId(assetKey); // Return ID if name not found
+}
+
+wxString GetAssetId(EntityKey assetKey) {
+    return assetKeys.GetId(assetKey);
+}
+
+wxString GetSubAssetId(EntityKey subAssetKey) {
+    return subAssetKeys.GetId(subAssetKey);
+}
+
+wxString GetTenderProjectId(EntityKey projectKey) {
+    return tenderKeys.GetId(projectKey);
+}
+
+wxString GenerateUniqueSubAssetId(const wxString& parentId, const wxString& type) {
+    TRACE_SCOPE("GenerateUniqueSubAssetId");
+    size_t count = 0;
+    EntityKey parent;
+    if (assetKeys.Find(parentId, parent)) {
+        count = subAssetIndex.GetSubAssetCount(parent);
+    }
+
+    // Setelah ada yang dihapus, nomor berikutnya bisa sudah dipakai sub-aset
+    // lain (bahkan parent-nya sendiri); lewati ID yang masih hidup
+    for (;;) {
+        count++; // next ID
+        std::ostringstream oss;
+        oss << parentId << "-" << type << std::setw(3) << std::setfill('0') << count;
+        wxString id(oss.str());
+        EntityKey existing;
+        if (!subAssetKeys.Find(id, existing) || !findSubAsset(existing)) return id;
+    }
+}
+
+// Versi read-only, aman dipanggil dari worker
+AssetTree<SubAssetHandle>* findAssetTree(const wxString& assetId) {
+    EntityKey key;
+    if (!assetKeys.Find(assetId, key)) return nullptr;
+    return findAssetTree(key);
+}
+
+AssetTree<SubAssetHandle>* findAssetTree(EntityKey assetKey) {
+    return subAssetIndex.FindTree(assetKey);
+}
+
+AssetTree<SubAssetHandle>* getOrCreateAssetTree(const wxString& assetId) {
+    EntityKey assetKey = assetKeys.Intern(assetId);
+    // Find existing tree
+    AssetTree<SubAssetHandle>* existing = findAssetTree(assetKey);
+    if (existing) return existing;
+
+    // Create new tree
+    AssetTree<SubAssetHandle>* newTree = new AssetTree<SubAssetHandle>();
+    // Create root node for the main asset
+    SubAssetHandle rootData = subAssetPool.create(subAssetKeys.Intern("ROOT-" + assetId),
+        "Root of " + GetAssetNameByKey(assetKey), assetKey);
+    TreeNode<SubAssetHandle>* rootNode = newTree->createNode(rootData);
+    newTree->setRoot(rootNode);
+    assetTrees.push_back(newTree);
+    subAssetIndex.AttachTree(newTree);
+
+    return newTree;
+}
+
+void AddSubAsset(const wxString& parentAssetId, const wxString& parentSubAssetId,
+    const wxString& nama, const wxString& description) {
+    TRACE_SCOPE("AddSubAsset");
+    RegistryWriteLock lock(DATA_SUB_ASET);
+    wxString subAssetId = GenerateUniqueSubAssetId(parentAssetId);
+    // Satu record di pool; list dan tree hanya memegang handle-nya
+    SubAssetHandle newSubAsset = subAssetPool.create(subAssetKeys.Intern(subAssetId), nama,
+        assetKeys.Intern(parentAssetId), description);
+
+    daftarSubAset.push_back(newSubAsset);
+    subAssetIndex.AttachListNode(daftarSubAset.getTail());
+
+    AssetTree<SubAssetHandle>* tree = getOrCreateAssetTree(parentAssetId);
+    TreeNode<SubAssetHandle>* newNode = tree->createNode(newSubAsset);
+
+    const SubAsset& root = subAssetPool.get(tree->getRoot()->data);
+    EntityKey parentKey;
+    if (parentSubAssetId.IsEmpty() || !subAssetKeys.Find(parentSubAssetId, parentKey) ||
+        parentKey == root.key) {
+        // Add to root
+        tree->addChild(tree->getRoot(), newNode);
+    }
+    else {
+        // Parent harus berada di tree aset yang sama
+        TreeNode<SubAssetHandle>* parentNode = subAssetIndex.FindTreeNode(parentKey);
+        if (parentNode && subAssetPool.get(parentNode->data).parentKey == root.parentKey) {
+            tree->addChild(parentNode, newNode);
+        }
+        else {
+            // Fallback to root if parent not found
+            tree->addChild(tree->getRoot(), newNode);
+        }
+    }
+    // Didaftarkan setelah tersambung agar rollup ancestor ikut bertambah
+    subAssetIndex.AttachTreeNode(newNode);
+}
+
+// Tree tempat node sub-aset berada (tree milik aset induknya)
+static AssetTree<SubAssetHandle>* findTreeOfNode(TreeNode<SubAssetHandle>* node) {
+    return node ? subAssetIndex.FindTree(subAssetPool.get(node->data).parentKey) : nullptr;
+}
+
+void DeleteSubAsset(const wxString& subAssetId) {
+    TRACE_SCOPE("DeleteSubAsset");
+    EntityKey key;
+    if (!subAssetKeys.Find(subAssetId, key)) return;
+
+    RegistryWriteLock lock(DATA_SUB_ASET);
+    // Record yang dilepas setelah list dan tree tidak lagi merujuknya
+    std::vector<SubAssetHandle> released;
+    auto eraseListNode = [&released](EntityKey subAssetKey) {
+        Node<SubAssetHandle>* listNode = subAssetIndex.FindListNode(subAssetKey);
+        if (!listNode) return;
+        released.push_back(listNode->data);
+        subAssetIndex.DetachListNode(listNode);
+        daftarSubAset.erase(listNode);
+    };
+
+    // Remove from tree beserta seluruh subtree-nya; setiap turunan ikut
+    // dihapus dari daftarSubAset dan pool, bukan hanya node yang dipilih
+    TreeNode<SubAssetHandle>* nodeToDelete = subAssetIndex.FindTreeNode(key);
+    AssetTree<SubAssetHandle>* tree = findTreeOfNode(nodeToDelete);
+    if (tree && nodeToDelete->parent) {
+        // Sewa seluruh subtree berakhir hari ini; riwayatnya dilepas dari key
+        // supaya ID yang dipakai ulang tidak mewarisinya
+        LedgerDay today = LedgerToday();
+        AssetTree<SubAssetHandle>::walk(nodeToDelete, [today, &eraseListNode](TreeNode<SubAssetHandle>* current, int) {
+            EntityKey currentKey = subAssetPool.get(current->data).key;
+            rentalLedger.ReleaseUnit(currentKey, today);
+            eraseListNode(currentKey);
+            });
+        subAssetIndex.DetachSubtree(nodeToDelete);
+        tree->destroySubtree(nodeToDelete);
+    }
+    else {
+        eraseListNode(key);
+    }
+
+    for (SubAssetHandle handle : released) {
+        subAssetPool.destroy(handle);
+    }
+}
+
+// Satu pemindahan; dipanggil di bawah write lock DATA_SUB_ASET
+static bool moveSubAssetLocked(const SubAssetMove& move) {
+    TreeNode<SubAssetHandle>* node = subAssetIndex.FindTreeNode(move.subAssetKey);
+    AssetTree<SubAssetHandle>* from = findTreeOfNode(node);
+    // Root tree tidak bisa dipindah
+    if (!from || !node->parent || move.assetKey >= assetKeys.size()) return false;
+
+    AssetTree<SubAssetHandle>* to = nullptr;
+    TreeNode<SubAssetHandle>* parent = nullptr;
+    if (move.parentKey != NO_ENTITY_KEY) {
+        // Parent harus berada di tree aset tujuan
+        parent = subAssetIndex.FindTreeNode(move.parentKey);
+        to = findTreeOfNode(parent);
+        if (!to || subAssetPool.get(parent->data).parentKey != move.assetKey) return false;
+    }
+    else {
+        // Aset yang punya tree pasti masih ada (tree dilepas bersama asetnya).
+        // Tanpa tree, key saja tidak cukup: key aset yang dihapus tidak ikut
+        // hilang, jadi cek daftarAset dulu sebelum membuat tree baru
+        to = findAssetTree(move.assetKey);
+        if (!to) {
+            bool live = false;
+            for (const auto& aset : daftarAset) {
+                if (aset.key == move.assetKey) {
+                    live = true;
+                    break;
+                }
+            }
+            if (!live) return false;
+            to = getOrCreateAssetTree(GetAssetId(move.assetKey));
+        }
+        parent = to->getRoot();
+    }
+    // Tujuan tidak boleh berada di subtree yang dipindah (cukup naik rantai parent)
+    for (TreeNode<SubAssetHandle>* up = parent; up; up = up->parent) {
+        if (up == node) return false;
+    }
+
+    subAssetIndex.RemoveFromAncestors(node);
+    if (from == to) {
+        from->detachSubtree(node);
+        to->addChild(parent, node);
+    }
+    else {
+        // Node tinggal di arena tree asal, jadi subtree disalin ke arena tujuan
+        TreeNode<SubAssetHandle>* copy = to->copySubtree(node);
+        from->destroySubtree(node);
+        to->addChild(parent, copy);
+        AssetTree<SubAssetHandle>::walk(copy, [&move](TreeNode<SubAssetHandle>* current, int) {
+            SubAsset& record = subAssetPool.get(current->data);
+            // Jumlah sub-aset per aset ikut pindah bersama node daftarSubAset-nya
+            Node<SubAssetHandle>* listNode = subAssetIndex.FindListNode(record.key);
+            if (listNode) subAssetIndex.DetachListNode(listNode);
+            record.parentKey = move.assetKey;
+            if (listNode) subAssetIndex.AttachListNode(listNode);
+            subAssetIndex.RelocateTreeNode(current);
+            });
+        node = copy;
+    }
+    subAssetIndex.AddToAncestors(node);
+    return true;
+}
+
+bool MoveSubAsset(const wxString& subAssetId, const wxString& newAssetId,
+    const wxString& newParentSubAssetId) {
+    TRACE_SCOPE("MoveSubAsset");
+    SubAssetMove move;
+    move.parentKey = NO_ENTITY_KEY;
+    if (!subAssetKeys.Find(subAssetId, move.subAssetKey) || !assetKeys.Find(newAssetId, move.assetKey)) return false;
+    if (!newParentSubAssetId.IsEmpty() && !subAssetKeys.Find(newParentSubAssetId, move.parentKey)) return false;
+
+    RegistryWriteLock lock(DATA_SUB_ASET);
+    bool moved = moveSubAssetLocked(move);
+    if (!moved) lock.MarkUnchanged();
+    return moved;
+}
+
+size_t MoveSubAssets(const std::vector<SubAssetMove>& moves) {
+    TRACE_SCOPE("MoveSubAssets");
+    RegistryWriteLock lock(DATA_SUB_ASET);
+    size_t moved = 0;
+    for (const SubAssetMove& move : moves) {
+        if (moveSubAssetLocked(move)) moved++;
+    }
+    if (moved == 0) lock.MarkUnchanged();
+    PERF_COUNT("MoveSubAssets/dipindah", moved);
+    return moved;
+}
+
+PooledListView<SubAsset, SubAssetOfAsset> GetSubAssetsForAsset(const wxString& assetId) {
+    EntityKey parent;
+    if (!assetKeys.Find(assetId, parent)) {
+        return PooledListView<SubAsset, SubAssetOfAsset>(nullptr, &subAssetPool, SubAssetOfAsset{ NO_ENTITY_KEY });
+    }
+    return PooledListView<SubAsset, SubAssetOfAsset>(daftarSubAset.getHead(), &subAssetPool, SubAssetOfAsset{ parent });
+}
+
+SubAsset* findSubAsset(EntityKey subAssetKey) {
+    SubAssetHandle handle = subAssetIndex.FindHandle(subAssetKey);
+    return handle == NO_POOL_HANDLE ? nullptr : &subAssetPool.get(handle);
+}
+
+bool IsSubAssetUnder(EntityKey subAssetKey, EntityKey ancestorKey) {
+    TreeNode<SubAssetHandle>* node = subAssetIndex.FindTreeNode(subAssetKey);
+    TreeNode<SubAssetHandle>* ancestor = subAssetIndex.FindTreeNode(ancestorKey);
+    AssetTree<SubAssetHandle>* tree = findTreeOfNode(node);
+    // Interval preorder hanya bisa dibandingkan di dalam tree yang sama
+    if (!tree || !ancestor || findTreeOfNode(ancestor) != tree) return false;
+    return tree->isInSubtree(ancestor, node);
+}
+
+int GetSubAssetDepth(EntityKey subAssetKey) {
+    TreeNode<SubAssetHandle>* node = subAssetIndex.FindTreeNode(subAssetKey);
+    AssetTree<SubAssetHandle>* tree = findTreeOfNode(node);
+    return tree ? tree->getDepth(node) : -1;
+}
+
+ArrayView<TreeNode<SubAssetHandle>*> GetSubAssetSubtree(EntityKey subAssetKey) {
+    TreeNode<SubAssetHandle>* node = subAssetIndex.FindTreeNode(subAssetKey);
+    AssetTree<SubAssetHandle>* tree = findTreeOfNode(node);
+    return tree ? tree->getSubtree(node) : ArrayView<TreeNode<SubAssetHandle>*>(nullptr, 0);
+}
+
+void UpdateSubAssetRental(const wxString& subAssetId, bool isRented,
+    const wxString& renterName, int rentalPrice) {
+    TRACE_SCOPE("UpdateSubAssetRental");
+    EntityKey key;
+    if (!subAssetKeys.Find(subAssetId, key)) return;
+
+    // List dan tree memakai record yang sama, jadi tampilan tree ikut berubah
+    SubAsset* subAsset = findSubAsset(key);
+    if (!subAsset) return;
+
+    RegistryWriteLock lock(DATA_SUB_ASET);
+    bool wasRented = subAsset->isRented;
+    wxString previousRenter = subAsset->renterName.ToWxString();
+    int previousPrice = subAsset->rentalPrice;
+    // Rollup ancestor: sumbangan lama dikurangi, yang baru ditambahkan
+    TreeNode<SubAssetHandle>* node = subAssetIndex.FindTreeNode(key);
+    if (node) subAssetIndex.RemoveFromAncestors(node);
+    subAsset->isRented = isRented;
+    subAsset->renterName = renterName;
+    subAsset->rentalPrice = rentalPrice;
+    if (node) subAssetIndex.AddToAncestors(node);
+
+    // Lease berjalan mengikuti data sewa; perubahan penyewa/harga membuka lease baru
+    bool changed = wasRented != isRented || (isRented &&
+        (previousRenter != renterName || previousPrice != rentalPrice));
+    if (!changed) return;
+    LedgerDay today = LedgerToday();
+    rentalLedger.CloseOpenLease(key, today);
+    if (isRented) rentalLedger.AddLease(key, today, LEASE_OPEN_END, rentalPrice, renterName);
+}
+
+std::vector<EntityKey> FindVacantSubAssets(LedgerDay start, LedgerDay end) {
+    PERF_SCOPE("FindVacantSubAssets");
+    std::vector<uint8_t> leased(subAssetKeys.size(), 0);
+    rentalLedger.VisitOverlapping(start, end, [&leased](const Lease& lease) {
+        if (lease.subAssetKey < leased.size()) leased[lease.subAssetKey] = 1;
+        });
+
+    std::vector<EntityKey> vacant;
+    for (EntityKey key = 0; key < leased.size(); key++) {
+        if (leased[key]) continue;
+        TreeNode<SubAssetHandle>* node = subAssetIndex.FindTreeNode(key);
+        if (node && node->parent) vacant.push_back(key);
+    }
+    return vacant;
+}
+
+std::vector<MonthlyOccupancy> ComputeMonthlyOccupancy(int year, int month, int count, TaskContext* context) {
+    PERF_SCOPE("ComputeMonthlyOccupancy");
+    std::vector<MonthlyOccupancy> result;
+    size_t units = 0;
+    for (AssetTree<SubAssetHandle>* tree : assetTrees) {
+        if (tree->getRoot()) units += subAssetIndex.GetRollup(subAssetPool.get(tree->getRoot()->data).key).units;
+    }
+
+    // Stempel per key supaya unit dengan beberapa lease dalam sebulan dihitung sekali
+    std::vector<uint32_t> seen(subAssetKeys.size(), 0);
+    for (int i = 0; i < count; i++) {
+        if (context && context->IsCancelled()) break;
+        int nextYear = month == 12 ? year + 1 : year;
+        int nextMonth = month == 12 ? 1 : month + 1;
+        LedgerDay start = LedgerDayFromDate(year, month, 1);
+        LedgerDay end = LedgerDayFromDate(nextYear, nextMonth, 1);
+
+        MonthlyOccupancy occupancy = { year, month, units, 0, 0.0 };
+        uint32_t stamp = static_cast<uint32_t>(i + 1);
+        long long leasedDays = 0;
+        rentalLedger.VisitOverlapping(start, end, [&](const Lease& lease) {
+            // Lease milik sub-aset yang sudah dihapus tidak dihitung
+            TreeNode<SubAssetHandle>* node = subAssetIndex.FindTreeNode(lease.subAssetKey);
+            if (!node || !node->parent) return;
+            leasedDays += std::min(end, lease.endDay) - std::max(start, lease.startDay);
+            if (seen[lease.subAssetKey] != stamp) {
+                seen[lease.subAssetKey] = stamp;
+                occupancy.leasedUnits++;
+            }
+            });
+        if (units > 0) occupancy.occupancyRate = static_cast<double>(leasedDays) / (static_cast<double>(units) * (end - start));
+        result.push_back(occupancy);
+
+        if (context) context->ReportProgress((i + 1) * 100 / count);
+        year = nextYear;
+        month = nextMonth;
+    }
+    return result;
+}
+
+// Ringkasan sewa turunan, mis. " | Okupansi 3/10 unit, Rp 4500000"
+static wxString formatRollup(const SubAssetRollup& rollup) {
+    wxString text = wxString::Format(" | Okupansi %u/%u unit", rollup.rented, rollup.units);
+    if (rollup.income > 0) text += wxString::Format(", Rp %lld", rollup.income);
+    return text;
+}
+
+void appendTreeRows(TreeNode<SubAssetHandle>* node, int depth, std::vector<TreeDisplayRow>& rows) {
+    // Preorder iteratif, jadi tree sedalam apa pun tidak menghabiskan stack
+    AssetTree<SubAssetHandle>::walk(node, [depth, &rows](TreeNode<SubAssetHandle>* current, int offset) {
+        int level = depth + offset;
+        const SubAsset& data = subAssetPool.get(current->data);
+        wxString id = subAssetKeys.GetId(data.key);
+        // Skip root node display
+        if (level <= 1 && id.StartsWith("ROOT-")) return;
+
+        // Indentation
+        wxString indent = wxString(' ', (level - 1) * 4);
+        wxString prefix = level > 1 ? "|-- " : "+-- ";
+        // Node info
+        wxString nodeText = indent + prefix;
+        if (data.isRented) {
+            nodeText += "[R] ";  // [R] for Rented
+        }
+        else {
+            nodeText += "[A] ";  // [A] for Asset
+        }
+        nodeText += data.nama + " (" + id + ")";
+
+        if (data.isRented) {
+            nodeText += wxString::Format(" - Disewa: %s (Rp %d)",
+                data.renterName.ToWxString(), data.rentalPrice);
+        }
+        if (current->firstChild) {
+            nodeText += formatRollup(subAssetIndex.GetRollup(data.key));
+        }
+        rows.push_back(TreeDisplayRow{ TREE_ROW_NODE, nodeText, id });
+        });
+}
+
+std::vector<TreeDisplayRow> BuildTreeDisplayRows(TaskContext* context) {
+    PERF_SCOPE("DisplayAssetTrees/rows");
+    std::vector<TreeDisplayRow> rows;
+
+    size_t total = context ? daftarAset.size() : 0;
+    size_t index = 0;
+    for (const auto& asset : daftarAset) {
+        if (context && (++index % TASK_CHECK_INTERVAL) == 0) {
+            if (context->IsCancelled()) break;
+            context->ReportProgress(static_cast<int>(index * 100 / total));
+        }
+        if (subAssetIndex.GetSubAssetCount(asset.key) == 0) continue;
+
+        // Asset header, dengan rollup root (seluruh sub-aset aset ini)
+        AssetTree<SubAssetHandle>* tree = subAssetIndex.FindTree(asset.key);
+        wxString header = wxString::Format(" %s (%s)", asset.nama.ToWxString(), GetAssetId(asset.key));
+        if (tree && tree->getRoot()) {
+            header += formatRollup(subAssetIndex.GetRollup(subAssetPool.get(tree->getRoot()->data).key));
+        }
+        rows.push_back(TreeDisplayRow{ TREE_ROW_HEADER, header, "" });
+
+        // Display tree structure
+        if (tree && tree->getRoot()) {
+            appendTreeRows(tree->getRoot(), 1, rows);
+        }
+
+        rows.push_back(TreeDisplayRow{ TREE_ROW_SEPARATOR, "", "" });
+    }
+    PERF_COUNT("DisplayAssetTrees/baris", rows.size());
+    return rows;
+}
+
+wxString GenerateUniqueTenderProjectId() {
+    static int counter = 1;
+    std::ostringstream oss;
+    oss << "TNR" << std::setfill('0') << std::setw(4) << counter++;
+    return wxString(oss.str());
+}
+
+void AddTenderProject(const wxString& nama, const wxString& kategori,
+    const wxString& description, const wxString& tenderDate,
+    int estimatedValue, const wxString& clientName, int priority) {
+    TRACE_SCOPE("AddTenderProject");
+    RegistryWriteLock lock(DATA_TENDER);
+    EntityKey key = tenderKeys.Intern(GenerateUniqueTenderProjectId());
+    queueTenderProjects.emplace(key, nama, kategori, description, "Pending",
+        tenderDate, estimatedValue, clientName, priority);
+}
+
+void DeleteTenderProject(const wxString& projectId) {
+    TRACE_SCOPE("DeleteTenderProject");
+    EntityKey key;
+    if (!tenderKeys.Find(projectId, key)) return;
+
+    RegistryWriteLock lock(DATA_TENDER);
+    queueTenderProjects.remove_if([key](const TenderProject& project) {
+        return project.key == key;
+        });
+}
+
+void UpdateTenderProjectStatus(const wxString& projectId, const wxString& newStatus) {
+    TRACE_SCOPE("UpdateTenderProjectStatus");
+    EntityKey key;
+    if (!tenderKeys.Find(projectId, key)) return;
+
+    RegistryWriteLock lock(DATA_TENDER);
+    for (auto it = queueTenderProjects.begin(); it != queueTenderProjects.end(); ++it) {
+        if ((*it).key == key) {
+            (*it).status = newStatus;
+            break;
+        }
+    }
+}
+
+// NEW: Asset History Helper Functions
+wxString GetCurrentTimeString() {
+    wxDateTime now = wxDateTime::Now();
+    return now.Format("%d/%m/%Y %H:%M");
+}
+
+void AddToAssetHistory(const wxString& assetId, const wxString& assetName, const wxString& assetType) {
+    TRACE_SCOPE("AddToAssetHistory");
+    RegistryWriteLock lock(DATA_HISTORY);
+    // Cek apakah aset yang sama sudah ada di top stack
+    AssetHistory* topItem = assetHistoryStack.peek();
+    if (topItem && topItem->assetId == assetId) {
+        lock.MarkUnchanged();
+        return; // Jangan tambah duplikat berturut-turut
+    }
+
+    // Hapus item yang sama dari stack (jika ada); item dipindah, bukan disalin
+    Stack<AssetHistory> tempStack;
+    while (!assetHistoryStack.empty()) {
+        AssetHistory* item = assetHistoryStack.peek();
+        if (item->assetId != assetId) {
+            tempStack.push(std::move(*item));
+        }
+        assetHistoryStack.pop();
+    }
+
+    // Kembalikan item ke stack (kecuali yang duplikat)
+    while (!tempStack.empty()) {
+        assetHistoryStack.push(std::move(*tempStack.peek()));
+        tempStack.pop();
+    }
+
+    // Tambahkan item baru ke top
+    assetHistoryStack.emplace(assetId, assetName, assetType, GetCurrentTimeString());
+}
+
+ListView<AssetHistory> GetAssetHistory() {
+    return assetHistoryStack.view();
+}
+
+ListView<TenderProject> GetTenderProjects() {
+    return queueTenderProjects.view();
+}
+
+TenderProject* GetNextTenderProject() {
+    return queueTenderProjects.peek();
+}
+
+void ProcessNextTenderProject() {
+    TRACE_SCOPE("ProcessNextTenderProject");
+    RegistryWriteLock lock(DATA_TENDER);
+    queueTenderProjects.dequeue();
+}
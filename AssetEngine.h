@@ -0,0 +1,425 @@
+#pragma once
+#include <wx/string.h>
+#include <wx/hashmap.h>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "AssetClusters.h"
+#include "CategoryDictionary.h"
+#include "DataStructures.h"
+#include "EntityKeys.h"
+#include "RentalLedger.h"
+#include "StringPool.h"
+#include "SubAssetIndex.h"
+
+// Engine aset tanpa GUI: data model, registry global, dan semua logika bisnis.
+// Hanya butuh wxBase (wxString, wxDateTime), jadi bisa dipakai aplikasi wx,
+// benchmark, maupun tool lain tanpa display.
+
+class TaskContext;
+struct LayoutEdge;
+
+// Struct definitions
+// Field teks memakai CompactString (UTF-8) atau InternedString (handle ke
+// stringInterner untuk nilai yang berulang), lihat StringPool.h.
+// Kategori ada di CategoryDictionary.h.
+// Entitas dirujuk lewat surrogate key (EntityKeys.h); ID teks ada di
+// assetKeys / subAssetKeys / tenderKeys.
+struct Aset {
+    CompactString nama;
+    EntityKey key;              // ID teks lewat GetAssetId
+    CategoryId kategori;        // ID di daftarKategori; nama lewat GetCategoryName
+    uint32_t categorySlot;      // posisi di index aset kategorinya (diisi AttachAsset)
+
+    Aset(EntityKey k, const wxString& n, CategoryId kat)
+        : nama(n), key(k), kategori(kat), categorySlot(0) {
+    }
+};
+
+struct AssetValueDetails {
+    EntityKey assetKey;
+    int currentValue;
+    int maintenanceCost;
+    int propertyTax;
+
+    AssetValueDetails(EntityKey asset, int val, int maint = 0, int tax = 0)
+        : assetKey(asset), currentValue(val), maintenanceCost(maint), propertyTax(tax) {
+    }
+};
+
+struct AssetConnection {
+    EntityKey fromAssetKey;
+    EntityKey toAssetKey;
+    int weight;
+    CompactString description;
+
+    AssetConnection(EntityKey from, EntityKey to, int w, const wxString& desc = "")
+        : fromAssetKey(from), toAssetKey(to), weight(w), description(desc) {
+    }
+};
+
+struct GraphNode {
+    EntityKey assetKey;
+    LinkedList<AssetConnection> connections;
+
+    GraphNode(EntityKey key) : assetKey(key) {}
+};
+
+
+struct CategoryCount {
+    wxString kategori;
+    int count;
+
+    CategoryCount(const wxString& k, int c = 0) : kategori(k), count(c) {}
+};
+
+struct SubAsset {
+    EntityKey key;            // ID teks lewat GetSubAssetId
+    EntityKey parentKey;      // key dari parent asset
+    CompactString nama;
+    CompactString description;
+    bool isRented;
+    InternedString renterName;
+    int rentalPrice;
+
+    SubAsset(EntityKey k, const wxString& n, EntityKey parent,
+        const wxString& desc = "", bool rented = false,
+        const wxString& renter = "", int price = 0)
+        : key(k), parentKey(parent), nama(n), description(desc),
+        isRented(rented), renterName(renter), rentalPrice(price) {
+    }
+};
+
+struct TenderProject {
+    EntityKey key;            // ID teks lewat GetTenderProjectId
+    CompactString nama;
+    InternedString kategori;
+    CompactString description;
+    InternedString status; // "Pending", "In Review", "Approved", "Rejected"
+    CompactString tenderDate;
+    int estimatedValue;
+    InternedString clientName;
+    int priority; // 1-5, where 1 is highest priority
+
+    TenderProject(EntityKey i, const wxString& n, const wxString& k,
+        const wxString& desc = "", const wxString& stat = "Pending",
+        const wxString& date = "", int value = 0, const wxString& client = "",
+        int prio = 3)
+        : key(i), nama(n), kategori(k), description(desc), status(stat),
+        tenderDate(date), estimatedValue(value), clientName(client), priority(prio) {
+    }
+};
+
+// History mencampur ID aset dan sub-aset dan hanya berisi 15 entri,
+// jadi tetap menyimpan ID teks
+struct AssetHistory {
+    CompactString assetId;
+    CompactString assetName;
+    InternedString assetType; // "Asset", "SubAsset", dll
+    CompactString accessTime; // timestamp sederhana
+    AssetHistory(const wxString& id, const wxString& name, const wxString& type, const wxString& time = "")
+        : assetId(id), assetName(name), assetType(type), accessTime(time) {
+    }
+};
+
+// GLOBAL REGISTRY (didefinisikan di AssetEngine.cpp)
+// ID teks <-> surrogate key per jenis entitas
+extern EntityKeyMap assetKeys;
+extern EntityKeyMap subAssetKeys;
+extern EntityKeyMap tenderKeys;
+
+extern Queue<TenderProject> queueTenderProjects;
+extern Stack<AssetHistory> assetHistoryStack;
+
+// Record sub-aset (termasuk root tree) hanya ada di subAssetPool; daftarSubAset
+// dan tree memegang handle ke pool. Record dilepas saat dihapus dari list
+// (root: saat tree-nya dihapus). Setiap node daftarSubAset, tree dan node
+// tree harus terdaftar di subAssetIndex.
+extern ObjectPool<SubAsset> subAssetPool;
+extern LinkedList<SubAssetHandle> daftarSubAset;
+extern LinkedList<AssetTree<SubAssetHandle>*> assetTrees;
+extern SubAssetIndex subAssetIndex;
+// Riwayat sewa sub-aset; lease berjalan selalu sama dengan data sewa record-nya
+extern RentalLedger rentalLedger;
+
+// Setiap node daftarAset harus terdaftar di index kategorinya
+// (daftarKategori.AttachAsset / DetachAsset)
+extern CategoryDictionary daftarKategori;
+extern LinkedList<Aset> daftarAset;
+extern LinkedList<AssetValueDetails> daftarDetailNilaiAset;
+extern LinkedList<AssetConnection> daftarKoneksiAset;
+// Cluster aset yang saling terhubung; ikut diperbarui Add/DeleteAssetConnection
+extern AssetClusters assetClusters;
+
+// DATA GENERATIONS
+// Satu counter per kelompok data; halaman yang di-cache dibangun ulang hanya
+// jika generation data yang dipakainya berubah sejak terakhir dibangun.
+enum DataDomain {
+    DATA_KATEGORI = 1 << 0,
+    DATA_ASET = 1 << 1,
+    DATA_NILAI_ASET = 1 << 2,
+    DATA_KONEKSI = 1 << 3,
+    DATA_SUB_ASET = 1 << 4,
+    DATA_HISTORY = 1 << 5,
+    DATA_TENDER = 1 << 6
+};
+const int DATA_DOMAIN_COUNT = 7;
+
+extern unsigned long dataGeneration[DATA_DOMAIN_COUNT];
+
+void BumpDataGeneration(unsigned domains);
+// Counter hanya naik, jadi jumlahnya berubah jika salah satu domain berubah
+unsigned long GetDataStamp(unsigned domains);
+
+// REGISTRY LOCK
+// Worker thread membaca registry dengan read lock. Semua perubahan registry
+// dilakukan di UI thread dengan write lock, sehingga pembacaan di UI thread
+// sendiri tidak perlu lock. Generation naik setiap kali write lock dilepas.
+extern std::shared_mutex registryMutex;
+extern std::atomic<unsigned long> registryGeneration;
+
+class RegistryReadLock {
+public:
+    RegistryReadLock() : lock(registryMutex) {}
+private:
+    std::shared_lock<std::shared_mutex> lock;
+};
+
+// domains: DataDomain yang diubah selama lock dipegang
+class RegistryWriteLock {
+public:
+    explicit RegistryWriteLock(unsigned domains) : lock(registryMutex), domains(domains) {}
+    ~RegistryWriteLock() {
+        if (domains) {
+            registryGeneration++;
+            BumpDataGeneration(domains);
+        }
+    }
+    void MarkUnchanged() { domains = 0; }
+private:
+    std::unique_lock<std::shared_mutex> lock;
+    unsigned domains;
+};
+
+// Interval pengecekan pembatalan/progress di loop worker
+const size_t TASK_CHECK_INTERVAL = 4096;
+
+typedef std::unordered_map<wxString, size_t, wxStringHash, wxStringEqual> StringIndexMap;
+typedef std::unordered_set<wxString, wxStringHash, wxStringEqual> StringSet;
+
+// Helper functions
+Node<CategoryCount>* findCategoryNode(LinkedList<CategoryCount>& counts, const wxString& key);
+void initializeCategoryCounts(const CategoryDictionary& daftarKategori, LinkedList<CategoryCount>& counts);
+// Jumlah aset diambil dari index per kategori, O(kategori)
+void countAssetsByCategory(const CategoryDictionary& daftarKategori, LinkedList<CategoryCount>& counts);
+Node<AssetValueDetails>* findAssetValueById(LinkedList<AssetValueDetails>& list, const wxString& id);
+Node<AssetValueDetails>* findAssetValueByKey(LinkedList<AssetValueDetails>& list, EntityKey assetKey);
+void addOrUpdateAssetValue(LinkedList<AssetValueDetails>& list, EntityKey assetKey, int currentValue, int maintenanceCost, int propertyTax);
+void initializeAssetValues(const LinkedList<Aset>& daftarAset, LinkedList<AssetValueDetails>& daftarDetailNilaiAset);
+void printCategoryCounts(const LinkedList<CategoryCount>& counts);
+void InitializeDefaultData();
+// Kosongkan seluruh registry (termasuk kategori); dipakai benchmark dan loader data
+void ClearAllData();
+
+// KATEGORI
+std::vector<wxString> GetCategoriesVector();
+// Case-insensitive, O(1)
+bool CategoryExists(const wxString& category);
+void AddCategory(const wxString& categoryName);
+// O(1): aset memegang ID kategori. false jika kategori tidak ada atau nama
+// baru sudah dipakai kategori lain.
+bool RenameCategory(const wxString& oldName, const wxString& newName);
+wxString GetCategoryName(CategoryId id);
+
+// Hasil perencanaan hapus kategori: node yang akan dilepas, dihitung tanpa
+// mengubah data sehingga bisa dijalankan di worker thread.
+struct CategoryDeletePlan {
+    wxString categoryName;
+    CategoryId categoryId;      // NO_CATEGORY jika nama tidak ditemukan
+    unsigned long generation;
+    bool cancelled;
+    std::vector<Node<Aset>*> assets;
+    std::vector<Node<AssetValueDetails>*> values;
+};
+
+// context diisi jika dijalankan di worker (cek pembatalan + progress)
+CategoryDeletePlan PlanDeleteCategory(const wxString& categoryName, TaskContext* context = nullptr);
+// Mengembalikan false jika registry berubah sejak plan dibuat (plan harus dibuat ulang)
+bool ApplyDeleteCategory(const CategoryDeletePlan& plan);
+void DeleteCategory(const wxString& categoryName);
+
+// ASET
+wxString GenerateUniqueAssetId(const wxString& type);
+// Kategori dicari case-insensitive; dibuat jika belum ada
+void AddAsset(const wxString& id, const wxString& nama, const wxString& kategori);
+void DeleteAsset(const wxString& assetId);
+// View atas daftarAset tanpa salinan; valid sampai registry berubah
+ListView<Aset> GetAssets();
+wxString GetAssetNameById(const wxString& assetId);
+wxString GetAssetNameByKey(EntityKey assetKey);
+// ID teks untuk tampilan; kosong jika key tidak dikenal
+wxString GetAssetId(EntityKey assetKey);
+wxString GetSubAssetId(EntityKey subAssetKey);
+wxString GetTenderProjectId(EntityKey projectKey);
+
+std::vector<Aset> SearchAssets(const wxString& searchTerm, TaskContext* context = nullptr);
+
+struct SearchResultRow {
+    Aset asset;
+    bool hasValue;
+    int currentValue;
+};
+
+std::vector<SearchResultRow> SearchAssetsWithValues(const wxString& searchTerm, TaskContext* context);
+
+// Okupansi satu bulan kalender dari ledger sewa. Unit = sub-aset yang masih
+// ada di tree sekarang; rate = hari tersewa / (unit x hari dalam bulan).
+struct MonthlyOccupancy {
+    int year;
+    int month;                  // 1..12
+    size_t units;
+    size_t leasedUnits;         // unit dengan lease yang beririsan dengan bulan ini
+    double occupancyRate;
+};
+
+// count bulan berturut-turut mulai dari year/month; O(log n + k) per bulan
+std::vector<MonthlyOccupancy> ComputeMonthlyOccupancy(int year, int month, int count,
+    TaskContext* context = nullptr);
+
+// Agregasi untuk halaman statistik
+struct StatisticsSnapshot {
+    std::vector<CategoryCount> categoryCounts;
+    size_t totalAssets;
+    bool hasValueDetails;
+    long long totalValue;
+    long long totalMaintenance;
+    long long totalTax;
+    // Dari rollup root tree sub-aset
+    size_t totalSubAssets;
+    size_t rentedSubAssets;
+    long long totalRentalIncome;
+    std::vector<MonthlyOccupancy> monthlyOccupancy;  // 12 bulan terakhir, lama -> baru
+};
+
+StatisticsSnapshot ComputeStatistics(TaskContext* context = nullptr);
+
+// MEMORI
+// Pemakaian memori satu struktur registry. Node dan byte node dari
+// CountingAllocator; byte string dihitung dengan menelusuri isi struktur.
+struct StructureMemory {
+    wxString name;
+    size_t nodes;
+    size_t payloadBytes;    // sizeof(record) x node
+    size_t overheadBytes;   // pointer node, list anak tree, header heap (perkiraan)
+    size_t stringBytes;     // blok heap CompactString / arena string pool
+
+    size_t TotalBytes() const { return payloadBytes + overheadBytes + stringBytes; }
+};
+
+struct MemoryReport {
+    std::vector<StructureMemory> structures;
+    size_t totalBytes;
+    bool cancelled;
+};
+
+// Jalankan di bawah RegistryReadLock; O(total node + panjang string)
+MemoryReport ComputeMemoryReport(TaskContext* context = nullptr);
+
+// KONEKSI (GRAPH)
+bool ConnectionExists(const wxString& fromId, const wxString& toId);
+bool connectionExists(EntityKey from, EntityKey to);
+void AddAssetConnection(const wxString& fromId, const wxString& toId, int weight, const wxString& description = "");
+void DeleteAssetConnection(const wxString& fromId, const wxString& toId);
+// Koneksi yang menyentuh satu aset (sebagai asal atau tujuan)
+struct ConnectionTouches {
+    EntityKey assetKey;
+    bool operator()(const AssetConnection& conn) const {
+        return conn.fromAssetKey == assetKey || conn.toAssetKey == assetKey;
+    }
+};
+
+ListView<AssetConnection> GetAssetConnections();
+FilteredListView<AssetConnection, ConnectionTouches> GetConnectionsForAsset(const wxString& assetId);
+void BuildConnectionGraph(std::vector<wxString>& labels, std::vector<LayoutEdge>& edges);
+// Terhubung langsung atau lewat aset lain; hampir O(1)
+bool AssetsInSameCluster(const wxString& fromId, const wxString& toId);
+// Cluster dengan >= 2 aset, terbesar dulu, paling banyak limit; O(cluster)
+std::vector<AssetCluster> GetAssetClusters(size_t limit);
+size_t GetLinkedClusterCount();
+
+// SUB-ASET (TREE)
+wxString GenerateUniqueSubAssetId(const wxString& parentId, const wxString& type = "SUB");
+// Versi read-only, aman dipanggil dari worker
+AssetTree<SubAssetHandle>* findAssetTree(const wxString& assetId);
+AssetTree<SubAssetHandle>* findAssetTree(EntityKey assetKey);
+AssetTree<SubAssetHandle>* getOrCreateAssetTree(const wxString& assetId);
+void AddSubAsset(const wxString& parentAssetId, const wxString& parentSubAssetId,
+    const wxString& nama, const wxString& description);
+void DeleteSubAsset(const wxString& subAssetId);
+// Pindahkan sub-aset beserta subtree-nya ke bawah sub-aset lain (boleh milik
+// aset lain) atau ke root aset jika newParentSubAssetId kosong. ID, data sewa
+// dan rollup tetap; O(depth + jumlah node yang pindah tree). false jika
+// sub-aset / aset tujuan tidak ada (termasuk aset yang sudah dihapus) atau
+// tujuan berada di subtree-nya sendiri.
+bool MoveSubAsset(const wxString& subAssetId, const wxString& newAssetId,
+    const wxString& newParentSubAssetId);
+struct SubAssetMove {
+    EntityKey subAssetKey;
+    EntityKey assetKey;         // aset tujuan
+    EntityKey parentKey;        // sub-aset tujuan; NO_ENTITY_KEY = root aset
+};
+// Banyak pemindahan di bawah satu write lock (reorganisasi besar); urutan
+// preorder tree dibangun ulang sekali saat dibaca berikutnya. Mengembalikan
+// jumlah pemindahan yang berhasil.
+size_t MoveSubAssets(const std::vector<SubAssetMove>& moves);
+struct SubAssetOfAsset {
+    EntityKey parentKey;
+    bool operator()(const SubAsset& subAsset) const { return subAsset.parentKey == parentKey; }
+};
+
+PooledListView<SubAsset, SubAssetOfAsset> GetSubAssetsForAsset(const wxString& assetId);
+// Record sub-aset (termasuk root tree); nullptr jika tidak ada
+SubAsset* findSubAsset(EntityKey subAssetKey);
+// Hierarki sub-aset lewat interval preorder tree: O(1) setelah tree diurutkan.
+// Root tree ikut dihitung (kedalaman 0); -1 / false / kosong jika key tidak ada di tree.
+bool IsSubAssetUnder(EntityKey subAssetKey, EntityKey ancestorKey);
+int GetSubAssetDepth(EntityKey subAssetKey);
+ArrayView<TreeNode<SubAssetHandle>*> GetSubAssetSubtree(EntityKey subAssetKey);
+// Perubahan sewa juga dicatat di rentalLedger: lease berjalan ditutup hari
+// ini dan lease baru dibuka jika unit masih disewa
+void UpdateSubAssetRental(const wxString& subAssetId, bool isRented,
+    const wxString& renterName, int rentalPrice);
+// Sub-aset (tanpa root tree) yang tidak punya lease di [start, end), urut key
+std::vector<EntityKey> FindVacantSubAssets(LedgerDay start, LedgerDay end);
+
+// Baris tampilan tree sub-aset, disusun di worker lalu dibuat widget-nya di UI thread
+enum TreeRowKind { TREE_ROW_HEADER, TREE_ROW_NODE, TREE_ROW_SEPARATOR };
+
+struct TreeDisplayRow {
+    TreeRowKind kind;
+    wxString text;
+    wxString subAssetId;
+};
+
+void appendTreeRows(TreeNode<SubAssetHandle>* node, int depth, std::vector<TreeDisplayRow>& rows);
+std::vector<TreeDisplayRow> BuildTreeDisplayRows(TaskContext* context = nullptr);
+
+// TENDER (QUEUE)
+wxString GenerateUniqueTenderProjectId();
+void AddTenderProject(const wxString& nama, const wxString& kategori,
+    const wxString& description, const wxString& tenderDate,
+    int estimatedValue, const wxString& clientName, int priority);
+void DeleteTenderProject(const wxString& projectId);
+void UpdateTenderProjectStatus(const wxString& projectId, const wxString& newStatus);
+ListView<TenderProject> GetTenderProjects();
+TenderProject* GetNextTenderProject();
+void ProcessNextTenderProject();
+
+// HISTORY (STACK)
+wxString GetCurrentTimeString();
+void AddToAssetHistory(const wxString& assetId, const wxString& assetName, const wxString& assetType);
+// Urut dari yang terbaru
+ListView<AssetHistory> GetAssetHistory();
@@ -0,0 +1,85 @@
+#include "AssetPicker.h"
+
+AssetPicker::AssetPicker(wxWindow* parent, const AssetPrefixIndex* index)
+    : wxPanel(parent, wxID_ANY), index(index) {
+    wxBoxSizer* sizer = new wxBoxSizer(wxVERTICAL);
+
+    input = new wxTextCtrl(this, wxID_ANY);
+    input->SetHint("Ketik ID atau nama aset...");
+    input->Bind(wxEVT_TEXT, &AssetPicker::OnInputChanged, this);
+
+    matchList = new wxListBox(this, wxID_ANY, wxDefaultPosition, wxSize(-1, 100),
+        0, nullptr, wxLB_SINGLE);
+    matchList->Bind(wxEVT_LISTBOX, &AssetPicker::OnMatchSelected, this);
+
+    sizer->Add(input, 0, wxEXPAND | wxBOTTOM, 2);
+    sizer->Add(matchList, 0, wxEXPAND);
+    SetSizer(sizer);
+
+    UpdateMatches();
+}
+
+void AssetPicker::UpdateMatches() {
+    index->FindPrefix(input->GetValue().Trim(), MAX_VISIBLE_MATCHES, shownEntries);
+
+    wxArrayString labels;
+    labels.Alloc(shownEntries.size());
+    int selectedRow = wxNOT_FOUND;
+    for (size_t i = 0; i < shownEntries.size(); i++) {
+        const AssetPrefixIndex::Entry& entry = index->GetEntry(shownEntries[i]);
+        labels.Add(entry.label);
+        if (entry.assetId == selectedAssetId) {
+            selectedRow = static_cast<int>(i);
+        }
+    }
+
+    matchList->Set(labels);
+    if (selectedRow != wxNOT_FOUND) {
+        matchList->SetSelection(selectedRow);
+    }
+    else if (!selectedAssetId.IsEmpty()) {
+        // Pilihan lama tidak lagi tampil; jangan biarkan tombol memakai aset
+        // yang tidak terlihat, pindah ke hasil pertama (atau kosong)
+        if (shownEntries.empty()) {
+            ChangeSelection(wxString());
+        }
+        else {
+            matchList->SetSelection(0);
+            ChangeSelection(index->GetEntry(shownEntries[0]).assetId);
+        }
+    }
+}
+
+void AssetPicker::ChangeSelection(const wxString& assetId) {
+    if (assetId == selectedAssetId) return;
+    selectedAssetId = assetId;
+
+    wxCommandEvent changed(wxEVT_CHOICE, GetId());
+    changed.SetEventObject(this);
+    changed.SetString(selectedAssetId);
+    ProcessWindowEvent(changed);
+}
+
+void AssetPicker::SelectMatch(int row) {
+    if (row < 0 || row >= static_cast<int>(shownEntries.size())) return;
+
+    matchList->SetSelection(row);
+    selectedAssetId = index->GetEntry(shownEntries[row]).assetId;
+}
+
+void AssetPicker::Reset() {
+    selectedAssetId.Clear();
+    input->ChangeValue("");
+    UpdateMatches();
+}
+
+void AssetPicker::OnInputChanged(wxCommandEvent& event) {
+    UpdateMatches();
+}
+
+void AssetPicker::OnMatchSelected(wxCommandEvent& event) {
+    int row = matchList->GetSelection();
+    if (row == wxNOT_FOUND || row >= static_cast<int>(shownEntries.size())) return;
+
+    ChangeSelection(index->GetEntry(shownEntries[row]).assetId);
+}
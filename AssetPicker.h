@@ -0,0 +1,37 @@
+#pragma once
+#include <wx/wx.h>
+#include <wx/listbox.h>
+#include <vector>
+#include "AssetPrefixIndex.h"
+
+// Pengganti wxChoice berisi semua aset: kotak ketik + daftar maksimal
+// MAX_VISIBLE_MATCHES hasil dari AssetPrefixIndex. ID aset dibawa langsung
+// oleh entry index, tanpa parsing teks. Mengirim wxEVT_CHOICE saat pilihan berubah,
+// termasuk saat ketikan menyembunyikan aset yang sedang dipilih.
+class AssetPicker : public wxPanel {
+public:
+    static const size_t MAX_VISIBLE_MATCHES = 30;
+
+    AssetPicker(wxWindow* parent, const AssetPrefixIndex* index);
+
+    // Kosong jika belum ada aset yang dipilih
+    wxString GetSelectedAssetId() const { return selectedAssetId; }
+
+    // Pilih hasil ke-row dari daftar yang sedang tampil (untuk default awal)
+    void SelectMatch(int row);
+    // Kosongkan input dan pilihan, lalu tampilkan ulang hasil awal
+    void Reset();
+
+private:
+    void UpdateMatches();
+    // Simpan pilihan baru dan kirim wxEVT_CHOICE jika berbeda
+    void ChangeSelection(const wxString& assetId);
+    void OnInputChanged(wxCommandEvent& event);
+    void OnMatchSelected(wxCommandEvent& event);
+
+    const AssetPrefixIndex* index;
+    wxTextCtrl* input;
+    wxListBox* matchList;
+    std::vector<size_t> shownEntries;
+    wxString selectedAssetId;
+};
@@ -0,0 +1,55 @@
+#include "AssetPrefixIndex.h"
+#include <algorithm>
+
+void AssetPrefixIndex::Clear() {
+    entries.clear();
+    keys.clear();
+}
+
+void AssetPrefixIndex::AddKey(const wxString& text, size_t entry) {
+    if (text.IsEmpty()) return;
+    keys.push_back(Key{ text.Lower().ToStdWstring(), entry });
+}
+
+void AssetPrefixIndex::Add(const wxString& assetId, const wxString& nama) {
+    size_t entry = entries.size();
+    entries.push_back(Entry{ assetId, assetId + " - " + nama });
+
+    AddKey(assetId, entry);
+    AddKey(nama, entry);
+
+    // Kata kedua dst. supaya "melati" menemukan "Kost Melati"
+    for (size_t i = 1; i < nama.length(); i++) {
+        if (nama[i - 1] == ' ' && nama[i] != ' ') {
+            AddKey(nama.Mid(i), entry);
+        }
+    }
+}
+
+void AssetPrefixIndex::Finalize() {
+    std::stable_sort(keys.begin(), keys.end());
+}
+
+void AssetPrefixIndex::FindPrefix(const wxString& prefix, size_t limit, std::vector<size_t>& result) const {
+    result.clear();
+
+    if (prefix.IsEmpty()) {
+        for (size_t i = 0; i < entries.size() && result.size() < limit; i++) {
+            result.push_back(i);
+        }
+        return;
+    }
+
+    std::wstring lowered = prefix.Lower().ToStdWstring();
+    auto it = std::lower_bound(keys.begin(), keys.end(), lowered,
+        [](const Key& key, const std::wstring& value) { return key.text < value; });
+
+    for (; it != keys.end() && result.size() < limit; ++it) {
+        if (it->text.compare(0, lowered.size(), lowered) != 0) break;
+
+        // Satu aset bisa cocok lewat beberapa kunci; limit kecil, jadi cek linear cukup
+        if (std::find(result.begin(), result.end(), it->entry) == result.end()) {
+            result.push_back(it->entry);
+        }
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <wx/string.h>
+#include <string>
+#include <vector>
+
+// Index prefix untuk autocomplete aset. Kunci (ID, nama lengkap, dan tiap kata
+// dari nama, huruf kecil) disimpan terurut; semua kunci dengan prefix yang sama
+// membentuk satu rentang, jadi query = binary search + ambil k entry pertama.
+class AssetPrefixIndex {
+public:
+    struct Entry {
+        wxString assetId;
+        wxString label;   // "id - nama"
+    };
+
+    void Clear();
+    void Add(const wxString& assetId, const wxString& nama);
+    // Wajib dipanggil setelah serangkaian Add sebelum FindPrefix
+    void Finalize();
+
+    // Index entry (urut kunci, tanpa duplikat aset) yang cocok dengan prefix.
+    // Prefix kosong mengembalikan entry sesuai urutan penambahan.
+    void FindPrefix(const wxString& prefix, size_t limit, std::vector<size_t>& result) const;
+
+    const Entry& GetEntry(size_t index) const { return entries[index]; }
+    size_t GetEntryCount() const { return entries.size(); }
+
+private:
+    struct Key {
+        std::wstring text;
+        size_t entry;
+
+        bool operator<(const Key& other) const {
+            return text < other.text;
+        }
+    };
+
+    void AddKey(const wxString& text, size_t entry);
+
+    std::vector<Entry> entries;
+    std::vector<Key> keys;
+};
@@ -0,0 +1,93 @@
+#include "CategoryDictionary.h"
+#include "AssetEngine.h"
+
+CategoryId CategoryDictionary::Add(const wxString& nama) {
+    wxString folded = nama.Lower();
+    auto found = foldedIndex.find(folded);
+    if (found != foldedIndex.end()) return found->second;
+
+    CategoryId id = static_cast<CategoryId>(entries.size());
+    entries.push_back(Kategori(id, nama));
+    foldedIndex[folded] = id;
+    activeCount++;
+    return id;
+}
+
+bool CategoryDictionary::Find(const wxString& nama, CategoryId& id) const {
+    auto found = foldedIndex.find(nama.Lower());
+    if (found == foldedIndex.end()) return false;
+    id = found->second;
+    return true;
+}
+
+bool CategoryDictionary::Rename(CategoryId id, const wxString& nama) {
+    if (!IsActive(id)) return false;
+
+    wxString folded = nama.Lower();
+    auto found = foldedIndex.find(folded);
+    if (found != foldedIndex.end() && found->second != id) return false;
+
+    foldedIndex.erase(entries[id].nama.ToWxString().Lower());
+    foldedIndex[folded] = id;
+    entries[id].nama = nama;
+    return true;
+}
+
+void CategoryDictionary::Remove(CategoryId id) {
+    if (!IsActive(id)) return;
+
+    Kategori& entry = entries[id];
+    foldedIndex.erase(entry.nama.ToWxString().Lower());
+    std::vector<Node<Aset>*>().swap(entry.assets);
+    entry.active = false;
+    activeCount--;
+}
+
+wxString CategoryDictionary::GetName(CategoryId id) const {
+    return id < entries.size() ? entries[id].nama.ToWxString() : wxString();
+}
+
+void CategoryDictionary::AttachAsset(Node<Aset>* node) {
+    CategoryId id = node->data.kategori;
+    if (id >= entries.size()) return;
+
+    std::vector<Node<Aset>*>& assets = entries[id].assets;
+    node->data.categorySlot = static_cast<uint32_t>(assets.size());
+    assets.push_back(node);
+}
+
+// Slot yang kosong diisi node terakhir (swap-remove)
+void CategoryDictionary::DetachAsset(const Aset& aset) {
+    if (aset.kategori >= entries.size()) return;
+
+    std::vector<Node<Aset>*>& assets = entries[aset.kategori].assets;
+    if (aset.categorySlot >= assets.size()) return;
+
+    Node<Aset>* last = assets.back();
+    assets[aset.categorySlot] = last;
+    last->data.categorySlot = aset.categorySlot;
+    assets.pop_back();
+}
+
+size_t CategoryDictionary::GetOverheadBytes() const {
+    size_t bytes = entries.capacity() * sizeof(Kategori);
+    for (const Kategori& entry : entries) {
+        bytes += entry.assets.capacity() * sizeof(Node<Aset>*);
+    }
+    // Node hash: key wxString + ID + pointer next + hash, ditambah bucket
+    bytes += foldedIndex.size() * (sizeof(wxString) + sizeof(CategoryId) + 2 * sizeof(void*) + HEAP_BLOCK_OVERHEAD) +
+        foldedIndex.bucket_count() * sizeof(void*);
+    return bytes;
+}
+
+void CategoryDictionary::clear() {
+    entries.clear();
+    foldedIndex.clear();
+    activeCount = 0;
+}
+
+void CategoryDictionary::swap(CategoryDictionary& other) {
+    entries.swap(other.entries);
+    foldedIndex.swap(other.foldedIndex);
+    std::swap(activeCount, other.activeCount);
+}
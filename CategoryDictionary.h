@@ -0,0 +1,89 @@
+#pragma once
+#include <wx/string.h>
+#include <wx/hashmap.h>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "DataStructures.h"
+#include "StringPool.h"
+
+// Kamus kategori: setiap kategori punya ID integer stabil dan aset hanya
+// menyimpan ID itu. Nama dicari case-insensitive lewat hash nama yang sudah
+// di-lowercase, jadi cek/rename O(1). Setiap kategori juga menyimpan index
+// node aset miliknya sehingga hapus kategori cukup menelusuri aset itu saja.
+//
+// ID tidak pernah dipakai ulang: kategori yang dihapus tetap ada sebagai
+// entri nonaktif (namanya tetap bisa dibaca, mis. untuk hasil pencarian yang
+// sudah tampil).
+
+struct Aset;
+
+typedef uint32_t CategoryId;
+const CategoryId NO_CATEGORY = 0xFFFFFFFFu;
+
+struct Kategori {
+    CategoryId id;
+    CompactString nama;
+    bool active;
+    std::vector<Node<Aset>*> assets;    // index aset kategori ini, urutan tidak dijaga
+
+    Kategori(CategoryId i, const wxString& n) : id(i), nama(n), active(true) {}
+};
+
+class CategoryDictionary {
+public:
+    CategoryDictionary() : activeCount(0) {}
+
+    // ID kategori dengan nama ini (case-insensitive), dibuat jika belum ada
+    CategoryId Add(const wxString& nama);
+    bool Find(const wxString& nama, CategoryId& id) const;
+    // Hanya nama dan index nama yang berubah; false jika nama dipakai kategori lain
+    bool Rename(CategoryId id, const wxString& nama);
+    // Index aset ikut dikosongkan; node aset dilepas sendiri oleh pemanggil
+    void Remove(CategoryId id);
+
+    bool IsActive(CategoryId id) const { return id < entries.size() && entries[id].active; }
+    const Kategori& Get(CategoryId id) const { return entries[id]; }
+    wxString GetName(CategoryId id) const;
+
+    // Daftarkan / lepas node aset di index kategorinya (aset.kategori), O(1)
+    void AttachAsset(Node<Aset>* node);
+    void DetachAsset(const Aset& aset);
+    const std::vector<Node<Aset>*>& GetAssets(CategoryId id) const { return entries[id].assets; }
+
+    // Jumlah kategori aktif
+    size_t size() const { return activeCount; }
+    bool empty() const { return activeCount == 0; }
+    // Jumlah ID yang pernah dibuat (termasuk kategori yang sudah dihapus)
+    size_t GetIdCount() const { return entries.size(); }
+
+    // Byte vector entri, index aset dan hash nama (perkiraan)
+    size_t GetOverheadBytes() const;
+
+    void clear();
+    void swap(CategoryDictionary& other);
+
+    // Iterasi kategori aktif, urut ID (= urutan dibuat)
+    struct const_iterator {
+        const CategoryDictionary* owner;
+        size_t index;
+
+        const_iterator(const CategoryDictionary* o, size_t i) : owner(o), index(i) { skipInactive(); }
+        const Kategori& operator*() const { return owner->entries[index]; }
+        const_iterator& operator++() { index++; skipInactive(); return *this; }
+        bool operator!=(const const_iterator& other) const { return index != other.index; }
+
+    private:
+        void skipInactive() {
+            while (index < owner->entries.size() && !owner->entries[index].active) index++;
+        }
+    };
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, entries.size()); }
+
+private:
+    std::vector<Kategori> entries;      // index = CategoryId
+    std::unordered_map<wxString, CategoryId, wxStringHash, wxStringEqual> foldedIndex;   // nama lowercase -> ID, hanya kategori aktif
+    size_t activeCount;
+};
@@ -0,0 +1,1026 @@
+#pragma once
+#include <wx/string.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Struktur data generik yang dipakai engine aset: linked list ganda,
+// tree n-ary, queue dan stack berbatas, union-find. Node list/queue/stack dialokasikan
+// per elemen lewat CountingAllocator sehingga pemakaian memori tiap struktur
+// terlihat; node tree tinggal di arena milik AssetTree.
+
+template <typename T>
+struct Node {
+    T data;
+    Node<T>* next;
+    Node<T>* prev;
+
+    // Argumen diteruskan ke konstruktor T (salin, pindah, atau emplace)
+    template <typename... Args>
+    explicit Node(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr) {}
+};
+
+// View read-only atas node yang hidup, tanpa menyalin data. Hanya valid
+// selama struktur asalnya tidak diubah (registry: di UI thread atau di bawah
+// RegistryReadLock).
+template <typename T>
+class ListView {
+public:
+    ListView(const Node<T>* first, size_t count) : first(first), count(count) {}
+
+    struct const_iterator {
+        const Node<T>* node;
+        const_iterator(const Node<T>* n) : node(n) {}
+
+        const T& operator*() const { return node->data; }
+        const T* operator->() const { return &node->data; }
+        const_iterator& operator++() { node = node->next; return *this; }
+        bool operator!=(const const_iterator& other) const { return node != other.node; }
+    };
+
+    const_iterator begin() const { return const_iterator(first); }
+    const_iterator end() const { return const_iterator(nullptr); }
+    size_t size() const { return count; }
+    bool empty() const { return first == nullptr; }
+
+private:
+    const Node<T>* first;
+    size_t count;
+};
+
+// Seperti ListView, tapi hanya elemen yang lolos predicate; ukuran baru
+// diketahui setelah ditelusuri
+template <typename T, typename Predicate>
+class FilteredListView {
+public:
+    FilteredListView(const Node<T>* first, Predicate pred) : first(first), pred(pred) {}
+
+    struct const_iterator {
+        const Node<T>* node;
+        const Predicate* pred;
+        const_iterator(const Node<T>* n, const Predicate* p) : node(n), pred(p) { skip(); }
+
+        const T& operator*() const { return node->data; }
+        const T* operator->() const { return &node->data; }
+        const_iterator& operator++() { node = node->next; skip(); return *this; }
+        bool operator!=(const const_iterator& other) const { return node != other.node; }
+
+    private:
+        void skip() {
+            while (node && !(*pred)(node->data)) node = node->next;
+        }
+    };
+
+    const_iterator begin() const { return const_iterator(first, &pred); }
+    const_iterator end() const { return const_iterator(nullptr, &pred); }
+    bool empty() const { return !(begin() != end()); }
+
+private:
+    const Node<T>* first;
+    Predicate pred;
+};
+
+// Statistik alokasi node satu struktur. Tidak atomic: struktur registry
+// hanya diubah di bawah RegistryWriteLock.
+struct AllocationStats {
+    size_t liveNodes;
+    size_t liveBytes;           // sizeof(node) x liveNodes, tanpa header malloc
+    size_t totalAllocations;    // kumulatif, untuk melihat churn
+
+    AllocationStats() : liveNodes(0), liveBytes(0), totalAllocations(0) {}
+};
+
+// Perkiraan header per alokasi heap (glibc/MSVC: dua pointer)
+const size_t HEAP_BLOCK_OVERHEAD = 2 * sizeof(void*);
+
+// Alokator node per struktur: mencatat jumlah dan ukuran node yang hidup
+template <typename NodeType>
+class CountingAllocator {
+public:
+    template <typename... Args>
+    NodeType* create(Args&&... args) {
+        NodeType* node = new NodeType(std::forward<Args>(args)...);
+        stats.liveNodes++;
+        stats.liveBytes += sizeof(NodeType);
+        stats.totalAllocations++;
+        return node;
+    }
+
+    void destroy(NodeType* node) {
+        delete node;
+        stats.liveNodes--;
+        stats.liveBytes -= sizeof(NodeType);
+    }
+
+    const AllocationStats& getStats() const { return stats; }
+
+    void swap(CountingAllocator<NodeType>& other) { std::swap(stats, other.stats); }
+
+private:
+    AllocationStats stats;
+};
+
+template <typename T>
+class LinkedList {
+private:
+    Node<T>* head;
+    Node<T>* tail;
+    CountingAllocator<Node<T>> allocator;
+
+public:
+    LinkedList() : head(nullptr), tail(nullptr) {}
+
+    struct iterator {
+        Node<T>* node;
+        iterator(Node<T>* n) : node(n) {}
+
+        T& operator*() { return node->data; }
+        iterator& operator++() { node = node->next; return *this; }
+        bool operator!=(const iterator& other) const { return node != other.node; }
+    };
+
+    iterator begin() { return iterator(head); }
+    iterator end() { return iterator(nullptr); }
+
+    ListView<T> view() const { return ListView<T>(head, size()); }
+
+    void push_back(const T& dataBaru) {
+        linkBack(allocator.create(dataBaru));
+    }
+
+    void push_back(T&& dataBaru) {
+        linkBack(allocator.create(std::move(dataBaru)));
+    }
+
+    // Bangun elemen langsung di node baru, tanpa objek sementara
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        Node<T>* baru = allocator.create(std::forward<Args>(args)...);
+        linkBack(baru);
+        return baru->data;
+    }
+
+    bool empty() const {
+        return head == nullptr;
+    }
+
+    void tampilkanSemua() const {
+        Node<T>* bantu = head;
+        while (bantu) {
+            bantu = bantu->next;
+        }
+    }
+
+    // Lepas node yang posisinya sudah diketahui, O(1)
+    void erase(Node<T>* node) {
+        if (node->prev)
+            node->prev->next = node->next;
+        else
+            head = node->next;
+
+        if (node->next)
+            node->next->prev = node->prev;
+        else
+            tail = node->prev;
+
+        allocator.destroy(node);
+    }
+
+    template <typename Predicate>
+    void remove_if(Predicate pred) {
+        Node<T>* current = head;
+        while (current) {
+            if (pred(current->data)) {
+                Node<T>* toDelete = current;
+
+                if (toDelete->prev)
+                    toDelete->prev->next = toDelete->next;
+                else
+                    head = toDelete->next;
+
+                if (toDelete->next)
+                    toDelete->next->prev = toDelete->prev;
+                else
+                    tail = toDelete->prev;
+
+                current = toDelete->next;
+                allocator.destroy(toDelete);
+            }
+            else {
+                current = current->next;
+            }
+        }
+    }
+
+    // Jumlah node dicatat alokator, O(1)
+    size_t size() const {
+        return allocator.getStats().liveNodes;
+    }
+
+    const AllocationStats& getAllocationStats() const { return allocator.getStats(); }
+
+    void clear() {
+        Node<T>* current = head;
+        while (current) {
+            Node<T>* next = current->next;
+            allocator.destroy(current);
+            current = next;
+        }
+        head = tail = nullptr;
+    }
+
+    // Tukar isi dua list tanpa menyalin node, O(1)
+    void swap(LinkedList<T>& other) {
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        allocator.swap(other.allocator);
+    }
+
+    ~LinkedList() {
+        clear();
+    }
+
+    Node<T>* getHead() const { return head; }
+    Node<T>* getTail() const { return tail; }
+
+private:
+    void linkBack(Node<T>* baru) {
+        if (!head) {
+            head = tail = baru;
+        }
+        else {
+            tail->next = baru;
+            baru->prev = tail;
+            tail = baru;
+        }
+    }
+};
+
+// View read-only atas potongan array bersebelahan (mis. subtree di urutan
+// preorder AssetTree); valid selama array-nya tidak diubah
+template <typename T>
+class ArrayView {
+public:
+    ArrayView(const T* first, size_t count) : first(first), count(count) {}
+
+    const T* begin() const { return first; }
+    const T* end() const { return first + count; }
+    const T& operator[](size_t index) const { return first[index]; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+private:
+    const T* first;
+    size_t count;
+};
+
+// Node tree n-ary dengan link first-child / next-sibling: anak tidak butuh
+// list (dan node list) sendiri, tambah dan lepas anak O(1). Node dibuat
+// lewat AssetTree::createNode dari arena milik tree.
+template <typename T>
+struct TreeNode {
+    T data;
+    // Interval preorder [entry, exit) dan kedalaman (root = 0); diisi
+    // AssetTree, hanya valid selama urutan tree tidak kotor
+    uint32_t entry;
+    uint32_t exit;
+    uint32_t depth;
+    TreeNode<T>* parent;
+    TreeNode<T>* firstChild;
+    TreeNode<T>* lastChild;
+    TreeNode<T>* nextSibling;
+    TreeNode<T>* prevSibling;
+
+    TreeNode(const T& d) : data(d), entry(0), exit(0), depth(0), parent(nullptr), firstChild(nullptr),
+        lastChild(nullptr), nextSibling(nullptr), prevSibling(nullptr) {}
+    TreeNode(T&& d) : data(std::move(d)), entry(0), exit(0), depth(0), parent(nullptr), firstChild(nullptr),
+        lastChild(nullptr), nextSibling(nullptr), prevSibling(nullptr) {}
+
+    // Anak baru ditaruh paling akhir (urutan tambah dijaga)
+    void addChild(TreeNode<T>* child) {
+        child->parent = this;
+        child->prevSibling = lastChild;
+        child->nextSibling = nullptr;
+        if (lastChild) lastChild->nextSibling = child;
+        else firstChild = child;
+        lastChild = child;
+    }
+
+    // Lepas dari parent tanpa menghapus node
+    void removeChild(TreeNode<T>* child) {
+        if (!child || child->parent != this) return;
+        if (child->prevSibling) child->prevSibling->nextSibling = child->nextSibling;
+        else firstChild = child->nextSibling;
+        if (child->nextSibling) child->nextSibling->prevSibling = child->prevSibling;
+        else lastChild = child->prevSibling;
+        child->parent = nullptr;
+        child->nextSibling = nullptr;
+        child->prevSibling = nullptr;
+    }
+};
+
+// Tree n-ary yang node-nya tinggal di arena milik tree: chunk bersebelahan
+// yang ukurannya berlipat (tree kecil tetap kecil), slot node yang dihapus
+// dipakai ulang. Semua penelusuran iteratif lewat link parent/sibling, jadi
+// kedalaman tree tidak dibatasi stack.
+//
+// Tree juga menyimpan urutan preorder (Euler tour): subtree sebuah node
+// adalah order[entry, exit), jadi cek "di bawah node X" O(1) dan subtree
+// bisa dibaca sebagai potongan array. Tambah / hapus subtree di ujung urutan
+// (mis. anak baru root) memperbarui interval O(depth); edit lain hanya
+// menandai urutan kotor, lalu urutan dibangun ulang sekali oleh query
+// berikutnya. Query boleh dipanggil beberapa pembaca sekaligus (di bawah
+// RegistryReadLock); pembangunan ulang dijaga mutex milik tree.
+template <typename T>
+class AssetTree {
+private:
+    static const size_t FIRST_CHUNK_NODES = 8;
+    static const size_t MAX_CHUNK_NODES = 4096;
+
+    struct Slot {
+        alignas(TreeNode<T>) unsigned char storage[sizeof(TreeNode<T>)];
+    };
+
+    struct Chunk {
+        Slot* slots;
+        size_t capacity;
+    };
+
+    TreeNode<T>* root;
+    std::vector<Chunk> chunks;
+    std::vector<TreeNode<T>*> freeNodes;
+    size_t chunkUsed;       // slot terpakai di chunk terakhir
+    size_t liveCount;
+    mutable std::vector<TreeNode<T>*> order;   // preorder dari root
+    mutable std::atomic<bool> orderDirty;
+    mutable std::mutex orderMutex;
+
+    TreeNode<T>* allocateSlot() {
+        if (!freeNodes.empty()) {
+            TreeNode<T>* node = freeNodes.back();
+            freeNodes.pop_back();
+            return node;
+        }
+        if (chunks.empty() || chunkUsed == chunks.back().capacity) {
+            size_t capacity = FIRST_CHUNK_NODES;
+            if (!chunks.empty()) {
+                capacity = chunks.back().capacity * 2;
+                if (capacity > MAX_CHUNK_NODES) capacity = MAX_CHUNK_NODES;
+            }
+            chunks.push_back(Chunk{ new Slot[capacity], capacity });
+            chunkUsed = 0;
+        }
+        return reinterpret_cast<TreeNode<T>*>(chunks.back().slots[chunkUsed++].storage);
+    }
+
+    void ensureOrder() const {
+        if (!orderDirty.load(std::memory_order_acquire)) return;
+        std::lock_guard<std::mutex> lock(orderMutex);
+        if (!orderDirty.load(std::memory_order_relaxed)) return;
+        order.clear();
+        walk(root, [this](TreeNode<T>* node, int depth) {
+            node->entry = static_cast<uint32_t>(order.size());
+            node->depth = static_cast<uint32_t>(depth);
+            order.push_back(node);
+            });
+        assignExits(0);
+        orderDirty.store(false, std::memory_order_release);
+    }
+
+    // exit setiap node di order[start..]: anak diproses sebelum parent (urutan mundur)
+    void assignExits(size_t start) const {
+        for (size_t i = start; i < order.size(); i++) {
+            order[i]->exit = static_cast<uint32_t>(i + 1);
+        }
+        for (size_t i = order.size(); i-- > start + 1;) {
+            TreeNode<T>* parent = order[i]->parent;
+            if (parent->exit < order[i]->exit) parent->exit = order[i]->exit;
+        }
+    }
+
+    void release(TreeNode<T>* node) {
+        node->~TreeNode<T>();
+        freeNodes.push_back(node);
+        liveCount--;
+    }
+
+public:
+    AssetTree() : root(nullptr), chunkUsed(0), liveCount(0), orderDirty(true) {}
+    AssetTree(const AssetTree&) = delete;
+    AssetTree& operator=(const AssetTree&) = delete;
+
+    TreeNode<T>* getRoot() const { return root; }
+
+    void setRoot(TreeNode<T>* newRoot) {
+        root = newRoot;
+        orderDirty.store(true, std::memory_order_relaxed);
+    }
+
+    // Node baru tanpa parent; sambungkan lewat setRoot / addChild
+    template <typename... Args>
+    TreeNode<T>* createNode(Args&&... args) {
+        TreeNode<T>* node = new (allocateSlot()) TreeNode<T>(T(std::forward<Args>(args)...));
+        liveCount++;
+        return node;
+    }
+
+    // Sambungkan child (node baru atau subtree yang sudah lepas) sebagai anak
+    // terakhir parent. Jika parent ada di ujung urutan preorder, interval
+    // diperbarui langsung O(depth + ukuran subtree child). Menyambung lewat
+    // TreeNode::addChild langsung tidak memperbarui urutan.
+    void addChild(TreeNode<T>* parent, TreeNode<T>* child) {
+        bool atTail = !orderDirty.load(std::memory_order_relaxed) && parent->exit == order.size();
+        parent->addChild(child);
+        if (!atTail) {
+            orderDirty.store(true, std::memory_order_relaxed);
+            return;
+        }
+        uint32_t start = static_cast<uint32_t>(order.size());
+        walk(child, [this, parent](TreeNode<T>* node, int depth) {
+            node->entry = static_cast<uint32_t>(order.size());
+            node->depth = parent->depth + 1 + depth;
+            order.push_back(node);
+            });
+        assignExits(start);
+        uint32_t added = static_cast<uint32_t>(order.size()) - start;
+        for (TreeNode<T>* ancestor = parent; ancestor; ancestor = ancestor->parent) {
+            ancestor->exit += added;
+        }
+    }
+
+    // Lepas subtree dari parent-nya tanpa menghapus node; bisa disambung lagi
+    // lewat addChild di tree yang sama
+    void detachSubtree(TreeNode<T>* start) {
+        if (!start) return;
+        if (!orderDirty.load(std::memory_order_relaxed) && start->exit == order.size() &&
+            start->entry < order.size() && order[start->entry] == start) {
+            // Subtree di ujung urutan: cukup potong dan kecilkan interval ancestor
+            uint32_t removed = start->exit - start->entry;
+            order.resize(start->entry);
+            for (TreeNode<T>* ancestor = start->parent; ancestor; ancestor = ancestor->parent) {
+                ancestor->exit -= removed;
+            }
+        }
+        else {
+            orderDirty.store(true, std::memory_order_relaxed);
+        }
+        if (start->parent) start->parent->removeChild(start);
+        if (start == root) root = nullptr;
+    }
+
+    // Salin subtree (boleh dari tree lain) ke arena tree ini, urutan anak
+    // dijaga. Hasilnya belum punya parent; sambungkan lewat addChild.
+    TreeNode<T>* copySubtree(TreeNode<T>* start) {
+        TreeNode<T>* copy = nullptr;
+        std::vector<TreeNode<T>*> path;     // salinan ancestor per kedalaman
+        walk(start, [this, &copy, &path](TreeNode<T>* node, int depth) {
+            TreeNode<T>* created = createNode(node->data);
+            path.resize(depth);
+            if (depth == 0) copy = created;
+            else path.back()->addChild(created);
+            path.push_back(created);
+            });
+        return copy;
+    }
+
+    // Lepas node dari parent-nya lalu kembalikan seluruh subtree ke arena
+    void destroySubtree(TreeNode<T>* start) {
+        if (!start) return;
+        detachSubtree(start);
+
+        // Turun ke daun paling kiri, hapus, lanjut ke sibling atau naik ke parent
+        TreeNode<T>* node = start;
+        while (node) {
+            if (node->firstChild) {
+                node = node->firstChild;
+                continue;
+            }
+            TreeNode<T>* next = nullptr;
+            if (node != start) {
+                if (node->nextSibling) {
+                    next = node->nextSibling;
+                }
+                else {
+                    // Anak terakhir: semua anak parent sudah dihapus
+                    next = node->parent;
+                    next->firstChild = next->lastChild = nullptr;
+                }
+            }
+            release(node);
+            node = next;
+        }
+    }
+
+    // Kunjungi subtree start secara preorder tanpa rekursi.
+    // visit(node, depth) dengan depth 0 untuk start; link tree tidak boleh diubah selama walk.
+    template <typename Visit>
+    static void walk(TreeNode<T>* start, Visit visit) {
+        int depth = 0;
+        TreeNode<T>* node = start;
+        while (node) {
+            visit(node, depth);
+            if (node->firstChild) {
+                node = node->firstChild;
+                depth++;
+                continue;
+            }
+            while (node != start && !node->nextSibling) {
+                node = node->parent;
+                depth--;
+            }
+            node = node == start ? nullptr : node->nextSibling;
+        }
+    }
+
+    // Tandai urutan kotor, mis. setelah node disambung langsung lewat TreeNode::addChild
+    void invalidateOrder() { orderDirty.store(true, std::memory_order_relaxed); }
+
+    // true jika node berada di subtree ancestor (termasuk ancestor sendiri);
+    // keduanya harus node tree ini. O(1) setelah urutan valid.
+    bool isInSubtree(const TreeNode<T>* ancestor, const TreeNode<T>* node) const {
+        if (!ancestor || !node) return false;
+        ensureOrder();
+        return ancestor->entry <= node->entry && node->entry < ancestor->exit;
+    }
+
+    // Node subtree (node sendiri di depan) sebagai potongan urutan preorder;
+    // valid sampai tree diubah
+    ArrayView<TreeNode<T>*> getSubtree(const TreeNode<T>* node) const {
+        if (!node) return ArrayView<TreeNode<T>*>(nullptr, 0);
+        ensureOrder();
+        return ArrayView<TreeNode<T>*>(order.data() + node->entry, node->exit - node->entry);
+    }
+
+    // key: surrogate key record (T::key)
+    TreeNode<T>* findNode(uint32_t key) {
+        TreeNode<T>* found = nullptr;
+        walk(root, [&found, key](TreeNode<T>* node, int) {
+            if (!found && node->data.key == key) found = node;
+            });
+        return found;
+    }
+
+    void getAllSubAssets(TreeNode<T>* node, LinkedList<T>& result) {
+        if (!node) return;
+        for (TreeNode<T>* current : getSubtree(node)) {
+            if (current != node) result.push_back(current->data);
+        }
+    }
+
+    int getDepth(const TreeNode<T>* node) const {
+        if (!node) return 0;
+        ensureOrder();
+        return static_cast<int>(node->depth);
+    }
+
+    // Jumlah node hidup dan byte arena (termasuk slot kosong)
+    size_t size() const { return liveCount; }
+    size_t getArenaBytes() const {
+        size_t bytes = 0;
+        for (const Chunk& chunk : chunks) {
+            bytes += chunk.capacity * sizeof(Slot);
+        }
+        return bytes;
+    }
+    size_t getChunkCount() const { return chunks.size(); }
+    size_t getOverheadBytes() const {
+        return chunks.capacity() * sizeof(Chunk) + freeNodes.capacity() * sizeof(TreeNode<T>*) +
+            order.capacity() * sizeof(TreeNode<T>*);
+    }
+
+    ~AssetTree() {
+        // Node hidup dihancurkan dulu (jika T punya destructor), lalu chunk dilepas sekaligus
+        walk(root, [](TreeNode<T>* node, int) { node->data.~T(); });
+        for (const Chunk& chunk : chunks) {
+            delete[] chunk.slots;
+        }
+    }
+};
+
+// QUEUE IMPLEMENTATION FOR TENDER PROJECTS
+template <typename T>
+class Queue {
+private:
+    Node<T>* front;
+    Node<T>* rear;
+    size_t count;
+    CountingAllocator<Node<T>> allocator;
+
+public:
+    Queue() : front(nullptr), rear(nullptr), count(0) {}
+
+    void enqueue(const T& data) {
+        linkRear(allocator.create(data));
+    }
+
+    void enqueue(T&& data) {
+        linkRear(allocator.create(std::move(data)));
+    }
+
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        Node<T>* newNode = allocator.create(std::forward<Args>(args)...);
+        linkRear(newNode);
+        return newNode->data;
+    }
+
+    bool dequeue() {
+        if (front == nullptr) return false;
+
+        Node<T>* temp = front;
+        front = front->next;
+
+        if (front != nullptr) {
+            front->prev = nullptr;
+        }
+        else {
+            rear = nullptr;
+        }
+
+        allocator.destroy(temp);
+        count--;
+        return true;
+    }
+
+    T* peek() {
+        return front ? &(front->data) : nullptr;
+    }
+
+    T* peekRear() {
+        return rear ? &(rear->data) : nullptr;
+    }
+
+    bool empty() const { return front == nullptr; }
+    size_t size() const { return count; }
+    const AllocationStats& getAllocationStats() const { return allocator.getStats(); }
+
+    // Iterator for displaying all items
+    struct iterator {
+        Node<T>* node;
+        iterator(Node<T>* n) : node(n) {}
+        T& operator*() { return node->data; }
+        iterator& operator++() { node = node->next; return *this; }
+        bool operator!=(const iterator& other) const { return node != other.node; }
+    };
+
+    iterator begin() { return iterator(front); }
+    iterator end() { return iterator(nullptr); }
+
+    ListView<T> view() const { return ListView<T>(front, count); }
+
+    // Method to remove specific item by ID
+    template <typename Predicate>
+    void remove_if(Predicate pred) {
+        Node<T>* current = front;
+        while (current) {
+            if (pred(current->data)) {
+                Node<T>* toDelete = current;
+
+                // Update links
+                if (toDelete->prev) {
+                    toDelete->prev->next = toDelete->next;
+                }
+                else {
+                    front = toDelete->next;
+                }
+
+                if (toDelete->next) {
+                    toDelete->next->prev = toDelete->prev;
+                }
+                else {
+                    rear = toDelete->prev;
+                }
+
+                current = toDelete->next;
+                allocator.destroy(toDelete);
+                count--;
+            }
+            else {
+                current = current->next;
+            }
+        }
+    }
+
+    void clear() {
+        while (!empty()) {
+            dequeue();
+        }
+    }
+
+    void swap(Queue<T>& other) {
+        std::swap(front, other.front);
+        std::swap(rear, other.rear);
+        std::swap(count, other.count);
+        allocator.swap(other.allocator);
+    }
+
+    ~Queue() {
+        clear();
+    }
+
+private:
+    void linkRear(Node<T>* newNode) {
+        if (rear == nullptr) {
+            front = rear = newNode;
+        }
+        else {
+            rear->next = newNode;
+            newNode->prev = rear;
+            rear = newNode;
+        }
+        count++;
+    }
+};
+
+// NEW: Stack implementation
+template <typename T>
+class Stack {
+private:
+    Node<T>* top;
+    size_t count;
+    size_t maxSize; // Batasan maksimal item
+    CountingAllocator<Node<T>> allocator;
+
+public:
+    Stack(size_t maxSize = 10) : top(nullptr), count(0), maxSize(maxSize) {}
+
+    void push(const T& data) {
+        linkTop(allocator.create(data));
+    }
+
+    void push(T&& data) {
+        linkTop(allocator.create(std::move(data)));
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        linkTop(allocator.create(std::forward<Args>(args)...));
+    }
+
+    bool pop() {
+        if (top == nullptr) return false;
+        Node<T>* temp = top;
+        top = top->next;
+        if (top != nullptr) top->prev = nullptr;
+        allocator.destroy(temp);
+        count--;
+        return true;
+    }
+
+    T* peek() { return top ? &(top->data) : nullptr; }
+    bool empty() const { return top == nullptr; }
+    size_t size() const { return count; }
+    const AllocationStats& getAllocationStats() const { return allocator.getStats(); }
+
+    struct iterator {
+        Node<T>* node;
+        iterator(Node<T>* n) : node(n) {}
+        T& operator*() { return node->data; }
+        iterator& operator++() { node = node->next; return *this; }
+        bool operator!=(const iterator& other) const { return node != other.node; }
+    };
+    iterator begin() { return iterator(top); }
+    iterator end() { return iterator(nullptr); }
+
+    ListView<T> view() const { return ListView<T>(top, count); }
+
+    void clear() { while (!empty()) { pop(); } }
+
+    ~Stack() { clear(); }
+
+private:
+    void linkTop(Node<T>* newNode) {
+        newNode->next = top;
+        if (top != nullptr) top->prev = newNode;
+        top = newNode;
+        count++;
+
+        // Batasi ukuran stack - hapus yang paling lama jika melebihi batas
+        if (count > maxSize) {
+            Node<T>* current = top;
+            // Cari node terakhir
+            while (current->next != nullptr) {
+                current = current->next;
+            }
+            // Hapus node terakhir
+            if (current->prev) current->prev->next = nullptr;
+            allocator.destroy(current);
+            count--;
+        }
+    }
+};
+
+// POOL OBJEK DENGAN HANDLE
+// Satu tempat penyimpanan record: objek dibangun di chunk berukuran tetap
+// (alamat stabil selama hidup) dan dirujuk lewat handle 32-bit, sehingga list,
+// tree dan index bisa memakai record yang sama tanpa salinan. Slot yang
+// dilepas dipakai ulang oleh create berikutnya.
+typedef uint32_t PoolHandle;
+const PoolHandle NO_POOL_HANDLE = 0xFFFFFFFFu;
+
+template <typename T>
+class ObjectPool {
+public:
+    ObjectPool() : slotCount(0), liveCount(0) {}
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    template <typename... Args>
+    PoolHandle create(Args&&... args) {
+        PoolHandle handle;
+        if (!freeHandles.empty()) {
+            handle = freeHandles.back();
+            freeHandles.pop_back();
+        }
+        else {
+            if ((slotCount & CHUNK_MASK) == 0) chunks.push_back(new Slot[CHUNK_SIZE]);
+            handle = static_cast<PoolHandle>(slotCount++);
+            live.push_back(false);
+        }
+        new (slotAt(handle)) T(std::forward<Args>(args)...);
+        live[handle] = true;
+        liveCount++;
+        return handle;
+    }
+
+    void destroy(PoolHandle handle) {
+        if (!isLive(handle)) return;
+        get(handle).~T();
+        live[handle] = false;
+        freeHandles.push_back(handle);
+        liveCount--;
+    }
+
+    T& get(PoolHandle handle) { return *static_cast<T*>(slotAt(handle)); }
+    const T& get(PoolHandle handle) const { return *static_cast<const T*>(slotAt(handle)); }
+    bool isLive(PoolHandle handle) const { return handle < slotCount && live[handle]; }
+
+    // Jumlah record hidup / slot yang pernah dipakai (batas atas handle)
+    size_t size() const { return liveCount; }
+    size_t getSlotCount() const { return slotCount; }
+
+    // Byte chunk (termasuk slot kosong) dan tabel pendukung
+    size_t getChunkBytes() const { return chunks.size() * CHUNK_SIZE * sizeof(Slot); }
+    size_t getOverheadBytes() const {
+        return chunks.capacity() * sizeof(Slot*) + live.capacity() / 8 +
+            freeHandles.capacity() * sizeof(PoolHandle);
+    }
+
+    void clear() {
+        for (size_t handle = 0; handle < slotCount; handle++) {
+            if (live[handle]) get(static_cast<PoolHandle>(handle)).~T();
+        }
+        for (Slot* chunk : chunks) {
+            delete[] chunk;
+        }
+        std::vector<Slot*>().swap(chunks);
+        std::vector<bool>().swap(live);
+        std::vector<PoolHandle>().swap(freeHandles);
+        slotCount = 0;
+        liveCount = 0;
+    }
+
+    void swap(ObjectPool<T>& other) {
+        chunks.swap(other.chunks);
+        live.swap(other.live);
+        freeHandles.swap(other.freeHandles);
+        std::swap(slotCount, other.slotCount);
+        std::swap(liveCount, other.liveCount);
+    }
+
+    ~ObjectPool() { clear(); }
+
+private:
+    static const size_t CHUNK_BITS = 10;
+    static const size_t CHUNK_SIZE = size_t(1) << CHUNK_BITS;
+    static const size_t CHUNK_MASK = CHUNK_SIZE - 1;
+
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    void* slotAt(PoolHandle handle) const {
+        return chunks[handle >> CHUNK_BITS][handle & CHUNK_MASK].storage;
+    }
+
+    std::vector<Slot*> chunks;
+    std::vector<bool> live;
+    std::vector<PoolHandle> freeHandles;
+    size_t slotCount;
+    size_t liveCount;
+};
+
+// View atas list handle: record dibaca dari pool, hanya yang lolos predicate
+template <typename T, typename Predicate>
+class PooledListView {
+public:
+    PooledListView(const Node<PoolHandle>* first, const ObjectPool<T>* pool, Predicate pred)
+        : first(first), pool(pool), pred(pred) {}
+
+    struct const_iterator {
+        const Node<PoolHandle>* node;
+        const PooledListView* view;
+        const_iterator(const Node<PoolHandle>* n, const PooledListView* v) : node(n), view(v) { skip(); }
+
+        const T& operator*() const { return view->pool->get(node->data); }
+        const T* operator->() const { return &view->pool->get(node->data); }
+        const_iterator& operator++() { node = node->next; skip(); return *this; }
+        bool operator!=(const const_iterator& other) const { return node != other.node; }
+
+    private:
+        void skip() {
+            while (node && !view->pred(view->pool->get(node->data))) node = node->next;
+        }
+    };
+
+    const_iterator begin() const { return const_iterator(first, this); }
+    const_iterator end() const { return const_iterator(nullptr, this); }
+    bool empty() const { return !(begin() != end()); }
+
+private:
+    const Node<PoolHandle>* first;
+    const ObjectPool<T>* pool;
+    Predicate pred;
+};
+
+// UNION-FIND (DISJOINT SET)
+// Himpunan saling lepas atas indeks padat (mis. EntityKey) dengan union by
+// rank dan path compression: find/unite hampir O(1) amortized. Indeks di
+// luar ukuran saat ini dianggap singleton sampai grow dipanggil.
+class DisjointSet {
+public:
+    size_t size() const { return parent.size(); }
+
+    // Tambah singleton sampai ukuran count
+    void grow(size_t count) {
+        for (size_t i = parent.size(); i < count; i++) {
+            parent.push_back(static_cast<uint32_t>(i));
+        }
+        if (rank.size() < count) rank.resize(count, 0);
+        if (sizes.size() < count) sizes.resize(count, 1);
+    }
+
+    // Tanpa path compression, jadi aman dipanggil beberapa pembaca sekaligus;
+    // union by rank menjaga rantai O(log n), setelah flatten O(1)
+    uint32_t findRoot(uint32_t x) const {
+        if (x >= parent.size()) return x;
+        while (parent[x] != x) x = parent[x];
+        return x;
+    }
+
+    // Dengan path halving (path compression satu lintasan)
+    uint32_t find(uint32_t x) {
+        if (x >= parent.size()) return x;
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+
+    // false jika a dan b sudah satu himpunan
+    bool unite(uint32_t a, uint32_t b) {
+        uint32_t high = a > b ? a : b;
+        if (high >= parent.size()) grow(static_cast<size_t>(high) + 1);
+        a = find(a);
+        b = find(b);
+        if (a == b) return false;
+        if (rank[a] < rank[b]) std::swap(a, b);
+        parent[b] = a;
+        sizes[a] += sizes[b];
+        if (rank[a] == rank[b]) rank[a]++;
+        return true;
+    }
+
+    uint32_t setSize(uint32_t x) const {
+        x = findRoot(x);
+        return x < sizes.size() ? sizes[x] : 1;
+    }
+
+    // Arahkan semua indeks langsung ke root-nya
+    void flatten() {
+        for (size_t i = 0; i < parent.size(); i++) {
+            parent[i] = find(static_cast<uint32_t>(i));
+        }
+    }
+
+    size_t getMemoryBytes() const {
+        return parent.capacity() * sizeof(uint32_t) + rank.capacity() + sizes.capacity() * sizeof(uint32_t);
+    }
+
+    void clear() {
+        std::vector<uint32_t>().swap(parent);
+        std::vector<uint8_t>().swap(rank);
+        std::vector<uint32_t>().swap(sizes);
+    }
+
+private:
+    std::vector<uint32_t> parent;
+    std::vector<uint8_t> rank;
+    std::vector<uint32_t> sizes;    // valid di root
+};
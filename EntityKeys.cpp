@@ -0,0 +1,72 @@
+#include "EntityKeys.h"
+#include <cstring>
+
+EntityKeyMap::EntityKeyMap() {
+    clear();
+}
+
+// Cari slot berisi ID ini, atau slot kosong tempat menyisipkannya
+bool EntityKeyMap::FindSlot(const char* utf8, size_t length, size_t& slot) const {
+    size_t mask = slots.size() - 1;
+    slot = HashUtf8(utf8, length) & mask;
+    while (slots[slot] != 0) {
+        std::string_view id = GetUtf8(slots[slot] - 1);
+        if (id.size() == length && (length == 0 || std::memcmp(id.data(), utf8, length) == 0)) {
+            return true;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return false;
+}
+
+// Gandakan tabel hash saat terisi lebih dari separuh
+void EntityKeyMap::Grow() {
+    std::vector<uint32_t> grown(slots.size() * 2, 0);
+    size_t mask = grown.size() - 1;
+    for (uint32_t entry : slots) {
+        if (entry == 0) continue;
+        std::string_view id = GetUtf8(entry - 1);
+        size_t slot = HashUtf8(id.data(), id.size()) & mask;
+        while (grown[slot] != 0) slot = (slot + 1) & mask;
+        grown[slot] = entry;
+    }
+    slots.swap(grown);
+}
+
+EntityKey EntityKeyMap::Intern(const wxString& id) {
+    wxScopedCharBuffer utf8 = id.utf8_str();
+    size_t slot;
+    if (FindSlot(utf8.data(), utf8.length(), slot)) return slots[slot] - 1;
+
+    EntityKey key = static_cast<EntityKey>(size());
+    text.insert(text.end(), utf8.data(), utf8.data() + utf8.length());
+    offsets.push_back(static_cast<uint32_t>(text.size()));
+
+    slots[slot] = key + 1;
+    if (size() * 2 > slots.size()) Grow();
+    return key;
+}
+
+bool EntityKeyMap::Find(const wxString& id, EntityKey& key) const {
+    wxScopedCharBuffer utf8 = id.utf8_str();
+    size_t slot;
+    if (!FindSlot(utf8.data(), utf8.length(), slot)) return false;
+    key = slots[slot] - 1;
+    return true;
+}
+
+size_t EntityKeyMap::GetOverheadBytes() const {
+    return offsets.capacity() * sizeof(uint32_t) + slots.capacity() * sizeof(uint32_t);
+}
+
+void EntityKeyMap::clear() {
+    std::vector<char>().swap(text);
+    offsets.assign(1, 0);
+    slots.assign(1024, 0);
+}
+
+void EntityKeyMap::swap(EntityKeyMap& other) {
+    text.swap(other.text);
+    offsets.swap(other.offsets);
+    slots.swap(other.slots);
+}
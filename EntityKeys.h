@@ -0,0 +1,57 @@
+#pragma once
+#include <wx/string.h>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include "StringPool.h"
+
+// Surrogate key entitas: setiap ID teks (K0001, K0001-SUB003, ROOT-K0001,
+// TNR0001, ...) dipetakan ke key integer 32-bit yang padat (0, 1, 2, ...).
+// Record hanya menyimpan key; join, index dan adjacency graph cukup memakai
+// vector yang di-index key. ID teks hanya dibaca untuk tampilan dan
+// import/export.
+//
+// Key tidak pernah dipakai ulang dan ID yang sama selalu mendapat key yang
+// sama, jadi referensi ke entitas yang sudah dihapus (mis. koneksi ke aset
+// yang dihapus) tetap menunjuk ID yang sama seperti sebelumnya.
+
+typedef uint32_t EntityKey;
+const EntityKey NO_ENTITY_KEY = 0xFFFFFFFFu;
+
+class EntityKeyMap {
+public:
+    EntityKeyMap();
+
+    // Key untuk ID ini, dibuat jika belum ada (hanya di bawah write lock)
+    EntityKey Intern(const wxString& id);
+    // false jika ID belum pernah dipakai
+    bool Find(const wxString& id, EntityKey& key) const;
+
+    // UTF-8 ID milik key (kosong jika key tidak dikenal); valid sampai Intern berikutnya
+    std::string_view GetUtf8(EntityKey key) const {
+        if (key >= size()) return std::string_view();
+        return std::string_view(text.data() + offsets[key], offsets[key + 1] - offsets[key]);
+    }
+    wxString GetId(EntityKey key) const {
+        std::string_view id = GetUtf8(key);
+        return id.empty() ? wxString() : wxString::FromUTF8(id.data(), id.size());
+    }
+
+    // Jumlah key yang pernah dibuat; vector yang di-index key berukuran ini
+    size_t size() const { return offsets.size() - 1; }
+
+    // Tabel offset dan hash; teks ID lewat GetTextBytes
+    size_t GetOverheadBytes() const;
+    size_t GetTextBytes() const { return text.capacity(); }
+
+    void clear();
+    void swap(EntityKeyMap& other);
+
+private:
+    bool FindSlot(const char* utf8, size_t length, size_t& slot) const;
+    void Grow();
+
+    std::vector<char> text;             // semua ID berurutan, tanpa terminator
+    std::vector<uint32_t> offsets;      // key -> awal teks; offsets[key + 1] = akhir
+    std::vector<uint32_t> slots;        // open addressing, isi key + 1; 0 = kosong
+};
@@ -0,0 +1,211 @@
+#include "ForceLayout.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace {
+    const int EMPTY_CELL = -1;
+    const int MULTI_NODE_CELL = -2;   // beberapa node di posisi (hampir) sama
+    const int MAX_TREE_DEPTH = 24;
+    const double THETA = 0.9;         // makin besar makin kasar tapi makin cepat
+    const double MIN_DISTANCE2 = 0.01;
+    const double GRAVITY = 0.02;      // tarik komponen terpisah ke tengah
+    const double COOLING = 0.96;
+}
+
+ForceLayout::ForceLayout(size_t nodeCount, const std::vector<LayoutEdge>& edges, unsigned seed)
+    : edges(edges), idealLength(30.0), iteration(0) {
+    positions.resize(nodeCount);
+    displacement.resize(nodeCount);
+
+    double side = idealLength * std::sqrt(static_cast<double>(nodeCount) + 1.0);
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<double> coordinate(-side / 2, side / 2);
+    for (auto& point : positions) {
+        point.x = coordinate(random);
+        point.y = coordinate(random);
+    }
+
+    temperature = side / 10 + idealLength;
+    minTemperature = idealLength * 0.02;
+}
+
+bool ForceLayout::IsConverged() const {
+    return positions.size() < 2 || temperature < minTemperature || iteration >= MAX_ITERATIONS;
+}
+
+int ForceLayout::ChildFor(int cell, const LayoutPoint& point) const {
+    const QuadCell& c = cells[cell];
+    int quadrant = (point.x >= c.centerX ? 1 : 0) + (point.y >= c.centerY ? 2 : 0);
+    return c.firstChild + quadrant;
+}
+
+void ForceLayout::InsertNode(int node) {
+    const LayoutPoint& point = positions[node];
+    int cell = 0;
+    int depth = 0;
+
+    while (true) {
+        cells[cell].mass += 1;
+        cells[cell].sumX += point.x;
+        cells[cell].sumY += point.y;
+
+        if (cells[cell].firstChild >= 0) {
+            cell = ChildFor(cell, point);
+            depth++;
+            continue;
+        }
+
+        if (cells[cell].node == EMPTY_CELL) {
+            cells[cell].node = node;
+            return;
+        }
+
+        if (cells[cell].node == MULTI_NODE_CELL || depth >= MAX_TREE_DEPTH) {
+            cells[cell].node = MULTI_NODE_CELL;
+            return;
+        }
+
+        // Leaf sudah berisi satu node: pecah jadi 4 lalu turunkan node lama
+        int existing = cells[cell].node;
+        double half = cells[cell].half / 2;
+        double centerX = cells[cell].centerX;
+        double centerY = cells[cell].centerY;
+        int firstChild = static_cast<int>(cells.size());
+        for (int quadrant = 0; quadrant < 4; quadrant++) {
+            QuadCell child;
+            child.centerX = centerX + ((quadrant & 1) ? half : -half);
+            child.centerY = centerY + ((quadrant & 2) ? half : -half);
+            child.half = half;
+            child.mass = 0;
+            child.sumX = 0;
+            child.sumY = 0;
+            child.firstChild = -1;
+            child.node = EMPTY_CELL;
+            cells.push_back(child);
+        }
+        cells[cell].firstChild = firstChild;
+        cells[cell].node = EMPTY_CELL;
+
+        const LayoutPoint& existingPoint = positions[existing];
+        int existingChild = ChildFor(cell, existingPoint);
+        cells[existingChild].mass = 1;
+        cells[existingChild].sumX = existingPoint.x;
+        cells[existingChild].sumY = existingPoint.y;
+        cells[existingChild].node = existing;
+
+        cell = ChildFor(cell, point);
+        depth++;
+    }
+}
+
+void ForceLayout::BuildQuadTree() {
+    double minX = positions[0].x, maxX = positions[0].x;
+    double minY = positions[0].y, maxY = positions[0].y;
+    for (const auto& point : positions) {
+        minX = std::min(minX, point.x);
+        maxX = std::max(maxX, point.x);
+        minY = std::min(minY, point.y);
+        maxY = std::max(maxY, point.y);
+    }
+
+    QuadCell root;
+    root.centerX = (minX + maxX) / 2;
+    root.centerY = (minY + maxY) / 2;
+    root.half = std::max(maxX - minX, maxY - minY) / 2 + 1.0;
+    root.mass = 0;
+    root.sumX = 0;
+    root.sumY = 0;
+    root.firstChild = -1;
+    root.node = EMPTY_CELL;
+
+    cells.clear();
+    cells.reserve(positions.size() * 2);
+    cells.push_back(root);
+
+    for (size_t i = 0; i < positions.size(); i++) {
+        InsertNode(static_cast<int>(i));
+    }
+}
+
+void ForceLayout::AddRepulsion(size_t node, double& forceX, double& forceY) const {
+    const LayoutPoint& point = positions[node];
+    double k2 = idealLength * idealLength;
+
+    stack.clear();
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const QuadCell& cell = cells[stack.back()];
+        stack.pop_back();
+
+        if (cell.mass == 0) continue;
+        if (cell.node == static_cast<int>(node)) continue;
+
+        double dx = point.x - cell.sumX / cell.mass;
+        double dy = point.y - cell.sumY / cell.mass;
+        double distance2 = dx * dx + dy * dy;
+        double size = cell.half * 2;
+
+        // Cell cukup jauh (atau leaf): perlakukan sebagai satu massa di pusatnya
+        if (cell.firstChild < 0 || size * size < THETA * THETA * distance2) {
+            if (distance2 < MIN_DISTANCE2) {
+                // Posisi berimpit: dorong ke arah yang tetap tapi berbeda per node
+                dx = (node % 2 == 0) ? 0.1 : -0.1;
+                dy = (node % 3 == 0) ? 0.1 : -0.1;
+                distance2 = MIN_DISTANCE2;
+            }
+            double factor = k2 * cell.mass / distance2;
+            forceX += dx * factor;
+            forceY += dy * factor;
+        }
+        else {
+            for (int quadrant = 0; quadrant < 4; quadrant++) {
+                stack.push_back(cell.firstChild + quadrant);
+            }
+        }
+    }
+}
+
+void ForceLayout::Step() {
+    if (IsConverged()) return;
+
+    BuildQuadTree();
+
+    for (size_t i = 0; i < positions.size(); i++) {
+        double forceX = 0, forceY = 0;
+        AddRepulsion(i, forceX, forceY);
+        forceX -= positions[i].x * GRAVITY;
+        forceY -= positions[i].y * GRAVITY;
+        displacement[i].x = forceX;
+        displacement[i].y = forceY;
+    }
+
+    for (const auto& edge : edges) {
+        LayoutPoint& from = positions[edge.from];
+        LayoutPoint& to = positions[edge.to];
+        double dx = from.x - to.x;
+        double dy = from.y - to.y;
+        double distance = std::sqrt(dx * dx + dy * dy);
+        double factor = distance / idealLength;
+
+        displacement[edge.from].x -= dx * factor;
+        displacement[edge.from].y -= dy * factor;
+        displacement[edge.to].x += dx * factor;
+        displacement[edge.to].y += dy * factor;
+    }
+
+    for (size_t i = 0; i < positions.size(); i++) {
+        double dx = displacement[i].x;
+        double dy = displacement[i].y;
+        double length = std::sqrt(dx * dx + dy * dy);
+        if (length > temperature) {
+            dx *= temperature / length;
+            dy *= temperature / length;
+        }
+        positions[i].x += dx;
+        positions[i].y += dy;
+    }
+
+    temperature *= COOLING;
+    iteration++;
+}
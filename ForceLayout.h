@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+struct LayoutPoint {
+    double x;
+    double y;
+};
+
+struct LayoutEdge {
+    size_t from;
+    size_t to;
+};
+
+// Force-directed layout (Fruchterman-Reingold) tanpa dependensi GUI.
+// Tolakan antar node dihitung lewat quadtree Barnes-Hut: O(n log n) per Step,
+// tarikan per edge O(m). Satu objek hanya boleh dipakai satu thread pada satu waktu.
+class ForceLayout {
+public:
+    ForceLayout(size_t nodeCount, const std::vector<LayoutEdge>& edges, unsigned seed = 1);
+
+    // Satu iterasi: hitung gaya, geser node (dibatasi temperature), lalu dinginkan
+    void Step();
+    bool IsConverged() const;
+
+    const std::vector<LayoutPoint>& GetPositions() const { return positions; }
+    size_t GetIteration() const { return iteration; }
+
+    static const size_t MAX_ITERATIONS = 400;
+
+private:
+    // Cell quadtree; anak sebuah cell disimpan berurutan mulai firstChild
+    struct QuadCell {
+        double centerX, centerY, half;
+        double mass, sumX, sumY;
+        int firstChild;
+        int node;
+    };
+
+    void BuildQuadTree();
+    void InsertNode(int node);
+    int ChildFor(int cell, const LayoutPoint& point) const;
+    void AddRepulsion(size_t node, double& forceX, double& forceY) const;
+
+    std::vector<LayoutPoint> positions;
+    std::vector<LayoutPoint> displacement;
+    std::vector<LayoutEdge> edges;
+    std::vector<QuadCell> cells;
+    mutable std::vector<int> stack;
+
+    double idealLength;
+    double temperature;
+    double minTemperature;
+    size_t iteration;
+};
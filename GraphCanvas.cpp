@@ -0,0 +1,319 @@
+#include "GraphCanvas.h"
+#include <wx/dcbuffer.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace {
+    const double NODE_RADIUS = 6.0;        // radius node di koordinat dunia
+    const double MIN_SCALE = 0.001;
+    const double MAX_SCALE = 20.0;
+    const int LABEL_MIN_RADIUS = 4;        // label baru digambar jika node cukup besar
+    const size_t MAX_LABELS = 400;
+    const size_t EDGE_BUDGET = 20000;      // batas garis per frame, sisanya di-sampling
+    const int CHUNK_MILLISECONDS = 50;
+}
+
+GraphCanvas::GraphCanvas(wxWindow* parent, WorkerPool* workerPool)
+    : wxPanel(parent, wxID_ANY), workerPool(workerPool),
+    layoutIteration(0), layoutDone(true),
+    centerX(0), centerY(0), scale(1.0), viewTouched(false), dragging(false),
+    selectedNode(-1) {
+    SetBackgroundStyle(wxBG_STYLE_PAINT);
+    SetBackgroundColour(*wxWHITE);
+
+    Bind(wxEVT_PAINT, &GraphCanvas::OnPaint, this);
+    Bind(wxEVT_SIZE, &GraphCanvas::OnSize, this);
+    Bind(wxEVT_LEFT_DOWN, &GraphCanvas::OnMouseDown, this);
+    Bind(wxEVT_LEFT_UP, &GraphCanvas::OnMouseUp, this);
+    Bind(wxEVT_MOTION, &GraphCanvas::OnMouseMove, this);
+    Bind(wxEVT_MOUSEWHEEL, &GraphCanvas::OnMouseWheel, this);
+    Bind(wxEVT_LEFT_DCLICK, &GraphCanvas::OnDoubleClick, this);
+    Bind(wxEVT_MOUSE_CAPTURE_LOST, [this](wxMouseCaptureLostEvent&) { dragging = false; });
+}
+
+GraphCanvas::~GraphCanvas() {
+    layoutTask.Cancel();
+}
+
+void GraphCanvas::SetGraph(const std::vector<wxString>& nodeLabels, const std::vector<LayoutEdge>& graphEdges) {
+    layoutTask.Cancel();
+
+    labels = nodeLabels;
+    edges = graphEdges;
+    layout = std::make_shared<ForceLayout>(labels.size(), edges);
+    positions = layout->GetPositions();
+    layoutIteration = 0;
+    layoutDone = layout->IsConverged();
+    selectedNode = -1;
+    viewTouched = false;
+
+    FitToView();
+    Refresh(false);
+
+    if (!layoutDone) {
+        RunLayoutChunk();
+    }
+}
+
+void GraphCanvas::RunLayoutChunk() {
+    std::shared_ptr<ForceLayout> job = layout;
+
+    // Owner = frame induk, bukan panel ini: panel bisa dihancurkan saat halaman
+    // dibangun ulang, sedangkan worker masih memanggil CallAfter pada owner.
+    // Destructor membatalkan task sehingga callback tidak menyentuh panel lagi.
+    layoutTask = workerPool->Submit<LayoutFrame>(wxGetTopLevelParent(this),
+        [job](TaskContext& context) {
+            auto start = std::chrono::steady_clock::now();
+            do {
+                job->Step();
+            } while (!context.IsCancelled() && !job->IsConverged() &&
+                std::chrono::steady_clock::now() - start < std::chrono::milliseconds(CHUNK_MILLISECONDS));
+
+            LayoutFrame frame;
+            frame.positions = job->GetPositions();
+            frame.iteration = job->GetIteration();
+            frame.converged = job->IsConverged();
+            return frame;
+        },
+        [this](LayoutFrame& frame) {
+            positions.swap(frame.positions);
+            layoutIteration = frame.iteration;
+            layoutDone = frame.converged;
+
+            if (!viewTouched) FitToView();
+            Refresh(false);
+
+            if (!layoutDone) {
+                RunLayoutChunk();
+            }
+        });
+}
+
+void GraphCanvas::FitToView() {
+    wxSize size = GetClientSize();
+    if (positions.empty() || size.GetWidth() <= 0 || size.GetHeight() <= 0) return;
+
+    double minX = positions[0].x, maxX = positions[0].x;
+    double minY = positions[0].y, maxY = positions[0].y;
+    for (const auto& point : positions) {
+        minX = std::min(minX, point.x);
+        maxX = std::max(maxX, point.x);
+        minY = std::min(minY, point.y);
+        maxY = std::max(maxY, point.y);
+    }
+
+    double width = maxX - minX + NODE_RADIUS * 4;
+    double height = maxY - minY + NODE_RADIUS * 4;
+    centerX = (minX + maxX) / 2;
+    centerY = (minY + maxY) / 2;
+    scale = 0.9 * std::min(size.GetWidth() / width, size.GetHeight() / height);
+    scale = std::max(MIN_SCALE, std::min(MAX_SCALE, scale));
+}
+
+wxPoint GraphCanvas::ToScreen(const LayoutPoint& point) const {
+    // Dibatasi supaya konversi ke int tidak overflow saat zoom sangat dekat
+    const double limit = 1e6;
+    wxSize size = GetClientSize();
+    double x = (point.x - centerX) * scale + size.GetWidth() / 2;
+    double y = (point.y - centerY) * scale + size.GetHeight() / 2;
+    return wxPoint(static_cast<int>(std::max(-limit, std::min(limit, x))),
+        static_cast<int>(std::max(-limit, std::min(limit, y))));
+}
+
+LayoutPoint GraphCanvas::ToWorld(const wxPoint& point) const {
+    wxSize size = GetClientSize();
+    LayoutPoint world;
+    world.x = (point.x - size.GetWidth() / 2) / scale + centerX;
+    world.y = (point.y - size.GetHeight() / 2) / scale + centerY;
+    return world;
+}
+
+int GraphCanvas::FindNodeAt(const wxPoint& point) const {
+    LayoutPoint world = ToWorld(point);
+    double radius = std::max(NODE_RADIUS, 4.0 / scale);
+    double best = radius * radius;
+    int found = -1;
+
+    for (size_t i = 0; i < positions.size(); i++) {
+        double dx = positions[i].x - world.x;
+        double dy = positions[i].y - world.y;
+        double distance2 = dx * dx + dy * dy;
+        if (distance2 <= best) {
+            best = distance2;
+            found = static_cast<int>(i);
+        }
+    }
+    return found;
+}
+
+void GraphCanvas::OnPaint(wxPaintEvent& event) {
+    wxAutoBufferedPaintDC dc(this);
+    dc.SetBackground(*wxWHITE_BRUSH);
+    dc.Clear();
+
+    wxSize size = GetClientSize();
+    int width = size.GetWidth();
+    int height = size.GetHeight();
+
+    if (positions.empty()) {
+        dc.DrawText("Belum ada aset untuk digambar.", 10, 10);
+        return;
+    }
+
+    int radius = static_cast<int>(NODE_RADIUS * scale);
+    bool aggregated = radius < 2;   // zoom jauh: node digambar per blok piksel
+    int margin = std::max(radius, 2) + 1;
+
+    std::vector<wxPoint> screen(positions.size());
+    std::vector<char> visible(positions.size(), 0);
+    size_t visibleCount = 0;
+    for (size_t i = 0; i < positions.size(); i++) {
+        screen[i] = ToScreen(positions[i]);
+        if (screen[i].x >= -margin && screen[i].x <= width + margin &&
+            screen[i].y >= -margin && screen[i].y <= height + margin) {
+            visible[i] = 1;
+            visibleCount++;
+        }
+    }
+
+    // Edge: buang yang bounding box-nya di luar layar atau lebih pendek dari 2px
+    std::vector<size_t> edgeIndexes;
+    for (size_t i = 0; i < edges.size(); i++) {
+        const wxPoint& a = screen[edges[i].from];
+        const wxPoint& b = screen[edges[i].to];
+        if (std::max(a.x, b.x) < 0 || std::min(a.x, b.x) > width) continue;
+        if (std::max(a.y, b.y) < 0 || std::min(a.y, b.y) > height) continue;
+        if (std::abs(a.x - b.x) + std::abs(a.y - b.y) < 2) continue;
+        edgeIndexes.push_back(i);
+    }
+
+    size_t stride = edgeIndexes.size() / EDGE_BUDGET + 1;
+    dc.SetPen(wxPen(wxColour(200, 200, 200)));
+    for (size_t i = 0; i < edgeIndexes.size(); i += stride) {
+        const LayoutEdge& edge = edges[edgeIndexes[i]];
+        dc.DrawLine(screen[edge.from], screen[edge.to]);
+    }
+
+    if (selectedNode >= 0) {
+        dc.SetPen(wxPen(wxColour(220, 80, 60), 2));
+        for (const auto& edge : edges) {
+            if (edge.from == static_cast<size_t>(selectedNode) || edge.to == static_cast<size_t>(selectedNode)) {
+                dc.DrawLine(screen[edge.from], screen[edge.to]);
+            }
+        }
+    }
+
+    dc.SetPen(*wxTRANSPARENT_PEN);
+    dc.SetBrush(wxBrush(wxColour(60, 110, 180)));
+    if (aggregated) {
+        // Satu kotak 2x2 per blok piksel yang terisi, berapapun jumlah node di dalamnya
+        int gridWidth = width / 2 + 2;
+        int gridHeight = height / 2 + 2;
+        std::vector<char> occupied(static_cast<size_t>(gridWidth) * gridHeight, 0);
+        for (size_t i = 0; i < positions.size(); i++) {
+            if (!visible[i]) continue;
+            int gx = std::max(0, std::min(gridWidth - 1, screen[i].x / 2));
+            int gy = std::max(0, std::min(gridHeight - 1, screen[i].y / 2));
+            char& cell = occupied[static_cast<size_t>(gy) * gridWidth + gx];
+            if (cell) continue;
+            cell = 1;
+            dc.DrawRectangle(gx * 2, gy * 2, 2, 2);
+        }
+    }
+    else {
+        for (size_t i = 0; i < positions.size(); i++) {
+            if (visible[i]) {
+                dc.DrawCircle(screen[i], radius);
+            }
+        }
+    }
+
+    bool drawLabels = radius >= LABEL_MIN_RADIUS && visibleCount <= MAX_LABELS;
+    if (drawLabels) {
+        dc.SetTextForeground(wxColour(40, 40, 40));
+        for (size_t i = 0; i < positions.size(); i++) {
+            if (visible[i]) {
+                dc.DrawText(labels[i], screen[i].x + radius + 2, screen[i].y - radius);
+            }
+        }
+    }
+
+    if (selectedNode >= 0) {
+        const wxPoint& point = screen[selectedNode];
+        dc.SetBrush(wxBrush(wxColour(220, 80, 60)));
+        dc.DrawCircle(point, std::max(radius, 3) + 2);
+        dc.SetTextForeground(wxColour(160, 40, 30));
+        dc.DrawText(labels[selectedNode], point.x + std::max(radius, 3) + 4, point.y - 8);
+    }
+
+    wxString status = wxString::Format("%zu node, %zu koneksi", positions.size(), edges.size());
+    if (layoutDone) {
+        status += " - layout selesai";
+    }
+    else {
+        status += wxString::Format(" - menghitung layout (iterasi %zu/%zu)",
+            layoutIteration, ForceLayout::MAX_ITERATIONS);
+    }
+    dc.SetTextForeground(wxColour(90, 90, 90));
+    dc.DrawText(status, 8, 6);
+}
+
+void GraphCanvas::OnSize(wxSizeEvent& event) {
+    if (!viewTouched) FitToView();
+    Refresh(false);
+    event.Skip();
+}
+
+void GraphCanvas::OnMouseDown(wxMouseEvent& event) {
+    dragging = true;
+    dragStart = event.GetPosition();
+    lastMouse = dragStart;
+    CaptureMouse();
+}
+
+void GraphCanvas::OnMouseUp(wxMouseEvent& event) {
+    if (!dragging) return;
+    dragging = false;
+    if (HasCapture()) ReleaseMouse();
+
+    // Tanpa pergeseran berarti klik: pilih node di bawah kursor
+    wxPoint position = event.GetPosition();
+    if (std::abs(position.x - dragStart.x) + std::abs(position.y - dragStart.y) < 3) {
+        selectedNode = FindNodeAt(position);
+        Refresh(false);
+    }
+}
+
+void GraphCanvas::OnMouseMove(wxMouseEvent& event) {
+    if (!dragging || !event.LeftIsDown()) return;
+
+    wxPoint position = event.GetPosition();
+    centerX -= (position.x - lastMouse.x) / scale;
+    centerY -= (position.y - lastMouse.y) / scale;
+    lastMouse = position;
+    viewTouched = true;
+    Refresh(false);
+}
+
+void GraphCanvas::OnMouseWheel(wxMouseEvent& event) {
+    if (event.GetWheelDelta() == 0) return;
+
+    // Zoom di sekitar kursor: titik dunia di bawah kursor tetap di tempatnya
+    wxPoint position = event.GetPosition();
+    LayoutPoint anchor = ToWorld(position);
+    double steps = static_cast<double>(event.GetWheelRotation()) / event.GetWheelDelta();
+    scale = std::max(MIN_SCALE, std::min(MAX_SCALE, scale * std::pow(1.2, steps)));
+
+    wxSize size = GetClientSize();
+    centerX = anchor.x - (position.x - size.GetWidth() / 2) / scale;
+    centerY = anchor.y - (position.y - size.GetHeight() / 2) / scale;
+    viewTouched = true;
+    Refresh(false);
+}
+
+void GraphCanvas::OnDoubleClick(wxMouseEvent& event) {
+    viewTouched = false;
+    FitToView();
+    Refresh(false);
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <wx/wx.h>
+#include <memory>
+#include <vector>
+#include "ForceLayout.h"
+#include "WorkerPool.h"
+
+// Panel gambar untuk graph koneksi aset. Layout dihitung bertahap di WorkerPool,
+// posisi terbaru digambar dengan double buffer. Node/edge di luar layar dilewati
+// (culling) dan detail dikurangi saat zoom jauh (level-of-detail).
+// Geser: drag kiri, zoom: scroll, klik: pilih node, klik ganda: fit ke layar.
+class GraphCanvas : public wxPanel {
+public:
+    GraphCanvas(wxWindow* parent, WorkerPool* workerPool);
+    ~GraphCanvas();
+
+    // labels[i] = teks node ke-i, edges memakai index yang sama
+    void SetGraph(const std::vector<wxString>& labels, const std::vector<LayoutEdge>& edges);
+
+private:
+    struct LayoutFrame {
+        std::vector<LayoutPoint> positions;
+        size_t iteration;
+        bool converged;
+    };
+
+    void RunLayoutChunk();
+    void FitToView();
+
+    wxPoint ToScreen(const LayoutPoint& point) const;
+    LayoutPoint ToWorld(const wxPoint& point) const;
+    int FindNodeAt(const wxPoint& point) const;
+
+    void OnPaint(wxPaintEvent& event);
+    void OnSize(wxSizeEvent& event);
+    void OnMouseDown(wxMouseEvent& event);
+    void OnMouseUp(wxMouseEvent& event);
+    void OnMouseMove(wxMouseEvent& event);
+    void OnMouseWheel(wxMouseEvent& event);
+    void OnDoubleClick(wxMouseEvent& event);
+
+    WorkerPool* workerPool;
+    TaskHandle layoutTask;
+    std::shared_ptr<ForceLayout> layout;
+
+    std::vector<wxString> labels;
+    std::vector<LayoutEdge> edges;
+    std::vector<LayoutPoint> positions;
+    size_t layoutIteration;
+    bool layoutDone;
+
+    // Transformasi tampilan: layar = (dunia - center) * scale + tengah panel
+    double centerX, centerY, scale;
+    bool viewTouched;                // user sudah geser/zoom, jangan auto-fit lagi
+    bool dragging;
+    wxPoint dragStart;
+    wxPoint lastMouse;
+    int selectedNode;
+};
@@ -1,5 +1,15 @@
 #include "MainFrame.h"
+#include "AssetEngine.h"
+#include "WorkerPool.h"
+#include "GraphCanvas.h"
+#include "PerfMetrics.h"
+#include "PortfolioGenerator.h"
+#include "RentalBilling.h"
+#include "SpanningForest.h"
 #include <wx/wx.h>
+#include <wx/numdlg.h>
+#include <wx/filedlg.h>
+#include <wx/hashmap.h>
 #include <wx/sizer.h>
 #include <wx/grid.h>
 #include <iomanip> 
@@ -7,909 +17,125 @@
 #include <wx/statline.h>
 #include <sstream>  
 #include <vector>
+#include <deque>
+#include <atomic>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
 using namespace std;
 
-template <typename T>
-struct Node {
-    T data;
-    Node<T>* next;
-    Node<T>* prev;
-
-    Node(const T& d) : data(d), next(nullptr), prev(nullptr) {}
-};
-
-template <typename T>
-class LinkedList {
-private:
-    Node<T>* head;
-    Node<T>* tail;
-
+// Salinan koneksi di tombol hapus; dihapus otomatis bersama tombolnya
+class ConnectionClientData : public wxClientData {
 public:
-    LinkedList() : head(nullptr), tail(nullptr) {}
-
-    struct iterator {
-        Node<T>* node;
-        iterator(Node<T>* n) : node(n) {}
-
-        T& operator*() { return node->data; }
-        iterator& operator++() { node = node->next; return *this; }
-        bool operator!=(const iterator& other) const { return node != other.node; }
-    };
-
-    iterator begin() { return iterator(head); }
-    iterator end() { return iterator(nullptr); }
-
-    void push_back(const T& dataBaru) {
-        Node<T>* baru = new Node<T>(dataBaru);
-        if (!head) {
-            head = tail = baru;
-        }
-        else {
-            tail->next = baru;
-            baru->prev = tail;
-            tail = baru;
-        }
-    }
-
-    bool empty() const {
-        return head == nullptr;
-    }
-
-    void tampilkanSemua() const {
-        Node<T>* bantu = head;
-        while (bantu) {
-            bantu = bantu->next;
-        }
-    }
-
-    template <typename Predicate>
-    void remove_if(Predicate pred) {
-        Node<T>* current = head;
-        while (current) {
-            if (pred(current->data)) {
-                Node<T>* toDelete = current;
-
-                if (toDelete->prev)
-                    toDelete->prev->next = toDelete->next;
-                else
-                    head = toDelete->next;
-
-                if (toDelete->next)
-                    toDelete->next->prev = toDelete->prev;
-                else
-                    tail = toDelete->prev;
-
-                current = toDelete->next;
-                delete toDelete;
-            }
-            else {
-                current = current->next;
-            }
-        }
-    }
-
-    size_t size() const {
-        size_t count = 0;
-        Node<T>* current = head;
-        while (current) {
-            ++count;
-            current = current->next;
-        }
-        return count;
-    }
-
-    ~LinkedList() {
-        Node<T>* current = head;
-        while (current) {
-            Node<T>* next = current->next;
-            delete current;
-            current = next;
-        }
-    }
-
-    Node<T>* getHead() const { return head; }
-};
-
-// Struct definitions
-struct Kategori {
-    wxString nama;
-    Kategori(const wxString& n) : nama(n) {}
+    explicit ConnectionClientData(const AssetConnection& connection) : connection(connection) {}
+    AssetConnection connection;
 };
 
-struct Aset {
-    wxString id;
-    wxString nama;
-    wxString kategori;
-
-    Aset(const wxString& i, const wxString& n, const wxString& k)
-        : id(i), nama(n), kategori(k) {
-    }
+// Hasil worker halaman statistik
+struct StatisticsPageData {
+    StatisticsSnapshot statistics;
+    MemoryReport memory;
 };
 
-struct AssetValueDetails {
-    wxString assetId;
-    int currentValue;
-    int maintenanceCost;
-    int propertyTax;
-
-    AssetValueDetails(const wxString& id, int val, int maint = 0, int tax = 0)
-        : assetId(id), currentValue(val), maintenanceCost(maint), propertyTax(tax) {
-    }
-};
-
-struct AssetConnection {
-    wxString fromAssetId;
-    wxString toAssetId;
-    int weight;
-    wxString description;
-
-    AssetConnection(const wxString& from, const wxString& to, int w, const wxString& desc = "")
-        : fromAssetId(from), toAssetId(to), weight(w), description(desc) {
-    }
-};
-
-struct GraphNode {
-    wxString assetId;
-    LinkedList<AssetConnection> connections;
-
-    GraphNode(const wxString& id) : assetId(id) {}
-};
-
-
-struct CategoryCount {
-    wxString kategori;
-    int count;
-
-    CategoryCount(const wxString& k, int c = 0) : kategori(k), count(c) {}
-};
-
-struct SubAsset {
-    wxString id;
-    wxString nama;
-    wxString parentId;  // ID dari parent asset
-    wxString description;
-    bool isRented;
-    wxString renterName;
-    int rentalPrice;
-
-    SubAsset(const wxString& i, const wxString& n, const wxString& parent,
-        const wxString& desc = "", bool rented = false,
-        const wxString& renter = "", int price = 0)
-        : id(i), nama(n), parentId(parent), description(desc),
-        isRented(rented), renterName(renter), rentalPrice(price) {
-    }
-};
-
-template <typename T>
-struct TreeNode {
-    T data;
-    LinkedList<TreeNode<T>*> children;
-    TreeNode<T>* parent;
-
-    TreeNode(const T& d) : data(d), parent(nullptr) {}
-
-    void addChild(TreeNode<T>* child) {
-        child->parent = this;
-        children.push_back(child);
-    }
-
-    void removeChild(TreeNode<T>* child) {
-        children.remove_if([child](TreeNode<T>* node) {
-            return node == child;
-            });
-        if (child) {
-            child->parent = nullptr;
-        }
-    }
-
-    ~TreeNode() {
-        // Clean up children
-        Node<TreeNode<T>*>* current = children.getHead();
-        while (current) {
-            delete current->data;
-            current = current->next;
-        }
-    }
-};
-
-template <typename T>
-class AssetTree {
-private:
-    TreeNode<T>* root;
+static wxString FormatBytes(size_t bytes) {
+    if (bytes >= 1024 * 1024) return wxString::Format("%.1f MB", bytes / (1024.0 * 1024.0));
+    if (bytes >= 1024) return wxString::Format("%.1f KB", bytes / 1024.0);
+    return wxString::Format("%zu B", bytes);
+}
 
+// VIRTUAL LIST FOR TENDER QUEUE
+// Baris hanya diformat saat terlihat (OnGetItemText), posisi queue dihitung
+// dari index baris. Node queue tidak pernah pindah, jadi pointer aman disimpan.
+class TenderQueueListCtrl : public wxListCtrl {
 public:
-    AssetTree() : root(nullptr) {}
-
-    TreeNode<T>* getRoot() const { return root; }
-
-    void setRoot(TreeNode<T>* newRoot) { root = newRoot; }
-
-    TreeNode<T>* findNode(const wxString& id) {
-        return findNodeRecursive(root, id);
-    }
-
-    TreeNode<T>* findNodeRecursive(TreeNode<T>* node, const wxString& id) {
-        if (!node) return nullptr;
-
-        if (node->data.id == id) return node;
-
-        Node<TreeNode<T>*>* child = node->children.getHead();
-        while (child) {
-            TreeNode<T>* result = findNodeRecursive(child->data, id);
-            if (result) return result;
-            child = child->next;
-        }
-        return nullptr;
-    }
-
-    void getAllSubAssets(TreeNode<T>* node, LinkedList<T>& result) {
-        if (!node) return;
-
-        Node<TreeNode<T>*>* child = node->children.getHead();
-        while (child) {
-            result.push_back(child->data->data);
-            getAllSubAssets(child->data, result);
-            child = child->next;
+    TenderQueueListCtrl(wxWindow* parent)
+        : wxListCtrl(parent, wxID_ANY, wxDefaultPosition, wxSize(-1, 300),
+            wxLC_REPORT | wxLC_VIRTUAL | wxLC_SINGLE_SEL | wxLC_HRULES) {
+        InsertColumn(0, "#", wxLIST_FORMAT_RIGHT, 45);
+        InsertColumn(1, "ID", wxLIST_FORMAT_LEFT, 75);
+        InsertColumn(2, "Nama Proyek", wxLIST_FORMAT_LEFT, 160);
+        InsertColumn(3, "Kategori", wxLIST_FORMAT_LEFT, 90);
+        InsertColumn(4, "Status", wxLIST_FORMAT_LEFT, 80);
+        InsertColumn(5, "Prioritas", wxLIST_FORMAT_RIGHT, 60);
+        InsertColumn(6, "Klien", wxLIST_FORMAT_LEFT, 120);
+        InsertColumn(7, "Estimasi (Rp)", wxLIST_FORMAT_RIGHT, 100);
+        InsertColumn(8, "Tanggal Tender", wxLIST_FORMAT_LEFT, 95);
+        InsertColumn(9, "Deskripsi", wxLIST_FORMAT_LEFT, 200);
+    }
+
+    // Ambil ulang semua pointer dari queue (saat halaman dibuat)
+    void Reload() {
+        rows.clear();
+        for (auto it = queueTenderProjects.begin(); it != queueTenderProjects.end(); ++it) {
+            rows.push_back(&(*it));
         }
+        SetItemCount(static_cast<long>(rows.size()));
+        Refresh();
     }
 
-    int getDepth(TreeNode<T>* node) {
-        if (!node || !node->parent) return 0;
-        return 1 + getDepth(node->parent);
+    void AppendRow(TenderProject* project) {
+        rows.push_back(project);
+        SetItemCount(static_cast<long>(rows.size()));
+        RefreshItem(static_cast<long>(rows.size()) - 1);
     }
 
-    ~AssetTree() {
-        delete root;
-    }
-};
-
-struct TenderProject {
-    wxString id;
-    wxString nama;
-    wxString kategori;
-    wxString description;
-    wxString status; // "Pending", "In Review", "Approved", "Rejected"
-    wxString tenderDate;
-    int estimatedValue;
-    wxString clientName;
-    int priority; // 1-5, where 1 is highest priority
-
-    TenderProject(const wxString& i, const wxString& n, const wxString& k,
-        const wxString& desc = "", const wxString& stat = "Pending",
-        const wxString& date = "", int value = 0, const wxString& client = "",
-        int prio = 3)
-        : id(i), nama(n), kategori(k), description(desc), status(stat),
-        tenderDate(date), estimatedValue(value), clientName(client), priority(prio) {
-    }
-};
-
-// QUEUE IMPLEMENTATION FOR TENDER PROJECTS
-template <typename T>
-class Queue {
-private:
-    Node<T>* front;
-    Node<T>* rear;
-    size_t count;
-
-public:
-    Queue() : front(nullptr), rear(nullptr), count(0) {}
-
-    void enqueue(const T& data) {
-        Node<T>* newNode = new Node<T>(data);
-        if (rear == nullptr) {
-            front = rear = newNode;
+    // Posisi baris setelah 'row' bergeser, tapi hanya yang terlihat yang digambar ulang
+    void RemoveRow(long row) {
+        if (row < 0 || row >= static_cast<long>(rows.size())) return;
+        rows.erase(rows.begin() + row);
+        SetItemCount(static_cast<long>(rows.size()));
+        if (!rows.empty() && row < static_cast<long>(rows.size())) {
+            RefreshItems(row, static_cast<long>(rows.size()) - 1);
         }
-        else {
-            rear->next = newNode;
-            newNode->prev = rear;
-            rear = newNode;
-        }
-        count++;
     }
 
-    bool dequeue() {
-        if (front == nullptr) return false;
-
-        Node<T>* temp = front;
-        front = front->next;
-
-        if (front != nullptr) {
-            front->prev = nullptr;
-        }
-        else {
-            rear = nullptr;
+    void RefreshRow(long row) {
+        if (row >= 0 && row < static_cast<long>(rows.size())) {
+            RefreshItem(row);
         }
-
-        delete temp;
-        count--;
-        return true;
     }
 
-    T* peek() {
-        return front ? &(front->data) : nullptr;
+    TenderProject* GetProject(long row) const {
+        if (row < 0 || row >= static_cast<long>(rows.size())) return nullptr;
+        return rows[row];
     }
 
-    bool empty() const { return front == nullptr; }
-    size_t size() const { return count; }
-
-    // Iterator for displaying all items
-    struct iterator {
-        Node<T>* node;
-        iterator(Node<T>* n) : node(n) {}
-        T& operator*() { return node->data; }
-        iterator& operator++() { node = node->next; return *this; }
-        bool operator!=(const iterator& other) const { return node != other.node; }
-    };
-
-    iterator begin() { return iterator(front); }
-    iterator end() { return iterator(nullptr); }
-
-    // Method to remove specific item by ID
-    template <typename Predicate>
-    void remove_if(Predicate pred) {
-        Node<T>* current = front;
-        while (current) {
-            if (pred(current->data)) {
-                Node<T>* toDelete = current;
-
-                // Update links
-                if (toDelete->prev) {
-                    toDelete->prev->next = toDelete->next;
-                }
-                else {
-                    front = toDelete->next;
-                }
-
-                if (toDelete->next) {
-                    toDelete->next->prev = toDelete->prev;
-                }
-                else {
-                    rear = toDelete->prev;
-                }
-
-                current = toDelete->next;
-                delete toDelete;
-                count--;
-            }
-            else {
-                current = current->next;
-            }
-        }
+    long GetSelectedRow() const {
+        return GetNextItem(-1, wxLIST_NEXT_ALL, wxLIST_STATE_SELECTED);
     }
 
-    ~Queue() {
-        while (!empty()) {
-            dequeue();
-        }
-    }
-};
-
-struct AssetHistory {
-    wxString assetId;
-    wxString assetName;
-    wxString assetType; // "Asset", "SubAsset", dll
-    wxString accessTime; // timestamp sederhana
-    AssetHistory(const wxString& id, const wxString& name, const wxString& type, const wxString& time = "")
-        : assetId(id), assetName(name), assetType(type), accessTime(time) {
-    }
-};
+protected:
+    wxString OnGetItemText(long item, long column) const override {
+        const TenderProject* project = GetProject(item);
+        if (!project) return "";
 
-// NEW: Stack implementation
-template <typename T>
-class Stack {
-private:
-    Node<T>* top;
-    size_t count;
-    size_t maxSize; // Batasan maksimal item
-
-public:
-    Stack(size_t maxSize = 10) : top(nullptr), count(0), maxSize(maxSize) {}
-
-    void push(const T& data) {
-        Node<T>* newNode = new Node<T>(data);
-        newNode->next = top;
-        if (top != nullptr) top->prev = newNode;
-        top = newNode;
-        count++;
-
-        // Batasi ukuran stack - hapus yang paling lama jika melebihi batas
-        if (count > maxSize) {
-            Node<T>* current = top;
-            // Cari node terakhir
-            while (current->next != nullptr) {
-                current = current->next;
-            }
-            // Hapus node terakhir
-            if (current->prev) current->prev->next = nullptr;
-            delete current;
-            count--;
+        switch (column) {
+        case 0: return wxString::Format("%ld", item + 1);
+        case 1: return GetTenderProjectId(project->key);
+        case 2: return project->nama;
+        case 3: return project->kategori;
+        case 4: return project->status;
+        case 5: return wxString::Format("%d", project->priority);
+        case 6: return project->clientName.IsEmpty() ? wxString("Tidak disebutkan") : project->clientName;
+        case 7: return project->estimatedValue > 0 ? wxString::Format("%d", project->estimatedValue) : wxString("Tidak disebutkan");
+        case 8: return project->tenderDate.IsEmpty() ? wxString("Tidak disebutkan") : project->tenderDate;
+        case 9: return project->description;
         }
+        return "";
     }
 
-    bool pop() {
-        if (top == nullptr) return false;
-        Node<T>* temp = top;
-        top = top->next;
-        if (top != nullptr) top->prev = nullptr;
-        delete temp;
-        count--;
-        return true;
-    }
-
-    T* peek() { return top ? &(top->data) : nullptr; }
-    bool empty() const { return top == nullptr; }
-    size_t size() const { return count; }
-
-    struct iterator {
-        Node<T>* node;
-        iterator(Node<T>* n) : node(n) {}
-        T& operator*() { return node->data; }
-        iterator& operator++() { node = node->next; return *this; }
-        bool operator!=(const iterator& other) const { return node != other.node; }
-    };
-    iterator begin() { return iterator(top); }
-    iterator end() { return iterator(nullptr); }
-
-    ~Stack() { while (!empty()) { pop(); } }
+private:
+    std::deque<TenderProject*> rows;
 };
 
-// GLOBAL QUEUE FOR TENDER PROJECTS
-Queue<TenderProject> queueTenderProjects;
-
-Stack<AssetHistory> assetHistoryStack(15); 
-
-LinkedList<SubAsset> daftarSubAset;
-LinkedList<AssetTree<SubAsset>*> assetTrees;
-
-// Global data structures
-LinkedList<Kategori> daftarKategori;
-LinkedList<Aset> daftarAset;
-LinkedList<AssetValueDetails> daftarDetailNilaiAset;
-LinkedList<AssetConnection> daftarKoneksiAset;
-
-// Helper functions
-Node<CategoryCount>* findCategoryNode(LinkedList<CategoryCount>& counts, const wxString& key) {
-    Node<CategoryCount>* current = counts.getHead();
-    while (current) {
-        if (current->data.kategori == key) {
-            return current;
-        }
-        current = current->next;
-    }
-    return nullptr;
-}
-
-void initializeCategoryCounts(const LinkedList<Kategori>& daftarKategori, LinkedList<CategoryCount>& counts) {
-    Node<Kategori>* current = daftarKategori.getHead();
-    while (current) {
-        counts.push_back(CategoryCount(current->data.nama, 0));
-        current = current->next;
-    }
-}
-
-void countAssetsByCategory(const LinkedList<Aset>& daftarAset, LinkedList<CategoryCount>& counts) {
-    Node<Aset>* current = daftarAset.getHead();
-    while (current) {
-        Node<CategoryCount>* node = findCategoryNode(counts, current->data.kategori);
-        if (node) {
-            node->data.count++;
-        }
-        current = current->next;
-    }
-}
-
-Node<AssetValueDetails>* findAssetValueById(LinkedList<AssetValueDetails>& list, const wxString& id) {
-    Node<AssetValueDetails>* current = list.getHead();
-    while (current) {
-        if (current->data.assetId == id) {
-            return current;
-        }
-        current = current->next;
-    }
-    return nullptr;
-}
-
-void addOrUpdateAssetValue(LinkedList<AssetValueDetails>& list, const wxString& id, int currentValue, int maintenanceCost, int propertyTax) {
-    Node<AssetValueDetails>* node = findAssetValueById(list, id);
-    if (node) {
-        node->data.currentValue = currentValue;
-        node->data.maintenanceCost = maintenanceCost;
-        node->data.propertyTax = propertyTax;
-    }
-    else {
-        list.push_back(AssetValueDetails(id, currentValue, maintenanceCost, propertyTax));
-    }
-}
-
-void initializeAssetValues(const LinkedList<Aset>& daftarAset, LinkedList<AssetValueDetails>& daftarDetailNilaiAset) {
-    Node<Aset>* current = daftarAset.getHead();
-    while (current) {
-        if (!findAssetValueById(daftarDetailNilaiAset, current->data.id)) {
-            daftarDetailNilaiAset.push_back(AssetValueDetails(current->data.id, 1000, 0, 0));
-        }
-        current = current->next;
-    }
-}
-
-void printCategoryCounts(const LinkedList<CategoryCount>& counts) {
-    Node<CategoryCount>* current = counts.getHead();
-    while (current) {
-        wxPrintf("Category: %s, Count: %d\n", current->data.kategori, current->data.count);
-        current = current->next;
-    }
-}
-
-void InitializeDefaultData() {
-    if (daftarKategori.empty()) {
-        daftarKategori.push_back(Kategori("Kost"));
-        daftarKategori.push_back(Kategori("Gedung"));
-        daftarKategori.push_back(Kategori("Rumah"));
-        daftarKategori.push_back(Kategori("Emas"));
-        daftarKategori.push_back(Kategori("Kendaraan"));
-        daftarKategori.push_back(Kategori("Elektronik"));
-    }
-}
-
-wxString GenerateUniqueAssetId(const wxString& type) {
-    std::string prefix = type.SubString(0, 1).Upper().ToStdString();
-
-    int count = 0;
-    for (const auto& aset : daftarAset) {
-        if (aset.id.StartsWith(prefix)) {
-            count++;
-        }
-    }
-
-    count++; // next ID
-
-    std::ostringstream oss;
-    oss << prefix << std::setw(4) << std::setfill('0') << count;
-    return wxString(oss.str());
-}
-
-std::vector<wxString> GetCategoriesVector() {
-    std::vector<wxString> categories;
-    for (const auto& kategori : daftarKategori) {
-        categories.push_back(kategori.nama);
-    }
-    return categories;
-}
-
-bool CategoryExists(const wxString& category) {
-    for (const auto& kategori : daftarKategori) {
-        if (kategori.nama.IsSameAs(category, false)) {
-            return true;
-        }
-    }
-    return false;
-}
-
-void AddCategory(const wxString& categoryName) {
-    daftarKategori.push_back(Kategori(categoryName));
-}
-
-void DeleteCategory(const wxString& categoryName) {
-    // Remove assets with this category first
-    daftarAset.remove_if([&categoryName](const Aset& a) {
-        return a.kategori.IsSameAs(categoryName, false);
-        });
-
-    // Remove asset values for deleted assets
-    daftarDetailNilaiAset.remove_if([&categoryName](const AssetValueDetails& avd) {
-        // Check if this asset still exists
-        Node<Aset>* current = daftarAset.getHead();
-        while (current) {
-            if (current->data.id == avd.assetId) {
-                return false; // Asset exists, don't remove
-            }
-            current = current->next;
-        }
-        return true; // Asset doesn't exist, remove its value details
-        });
-
-    // Remove the category
-    daftarKategori.remove_if([&categoryName](const Kategori& k) {
-        return k.nama.IsSameAs(categoryName, false);
-        });
-}
-
-void AddAsset(const wxString& id, const wxString& nama, const wxString& kategori) {
-    daftarAset.push_back(Aset(id, nama, kategori));
-    // Initialize asset value with default values
-    addOrUpdateAssetValue(daftarDetailNilaiAset, id, 1000, 0, 0);
-}
-
-void DeleteAsset(const wxString& assetId) {
-    daftarAset.remove_if([&assetId](const Aset& a) {
-        return a.id.IsSameAs(assetId, false);
-        });
-
-    // Remove asset value details
-    daftarDetailNilaiAset.remove_if([&assetId](const AssetValueDetails& avd) {
-        return avd.assetId.IsSameAs(assetId, false);
-        });
-}
-
-std::vector<Aset> GetAssetsVector() {
-    std::vector<Aset> assets;
-    for (const auto& aset : daftarAset) {
-        assets.push_back(aset);
-    }
-    return assets;
-}
-
-std::vector<Aset> SearchAssets(const wxString& searchTerm) {
-    std::vector<Aset> results;
-    for (const auto& aset : daftarAset) {
-        if (aset.nama.Lower().Contains(searchTerm.Lower()) ||
-            aset.id.Lower().Contains(searchTerm.Lower()) ||
-            aset.kategori.Lower().Contains(searchTerm.Lower())) {
-            results.push_back(aset);
-        }
-    }
-    return results;
-}
-
-bool ConnectionExists(const wxString& fromId, const wxString& toId) {
-    Node<AssetConnection>* current = daftarKoneksiAset.getHead();
-    while (current) {
-        if ((current->data.fromAssetId == fromId && current->data.toAssetId == toId) ||
-            (current->data.fromAssetId == toId && current->data.toAssetId == fromId)) {
-            return true;
-        }
-        current = current->next;
-    }
-    return false;
-}
-
-void AddAssetConnection(const wxString& fromId, const wxString& toId, int weight, const wxString& description = "") {
-    if (!ConnectionExists(fromId, toId)) {
-        daftarKoneksiAset.push_back(AssetConnection(fromId, toId, weight, description));
-    }
-}
-
-void DeleteAssetConnection(const wxString& fromId, const wxString& toId) {
-    daftarKoneksiAset.remove_if([&fromId, &toId](const AssetConnection& conn) {
-        return (conn.fromAssetId == fromId && conn.toAssetId == toId) ||
-            (conn.fromAssetId == toId && conn.toAssetId == fromId);
-        });
-}
-
-std::vector<AssetConnection> GetAssetConnections() {
-    std::vector<AssetConnection> connections;
-    Node<AssetConnection>* current = daftarKoneksiAset.getHead();
-    while (current) {
-        connections.push_back(current->data);
-        current = current->next;
-    }
-    return connections;
-}
-
-std::vector<AssetConnection> GetConnectionsForAsset(const wxString& assetId) {
-    std::vector<AssetConnection> connections;
-    Node<AssetConnection>* current = daftarKoneksiAset.getHead();
-    while (current) {
-        if (current->data.fromAssetId == assetId || current->data.toAssetId == assetId) {
-            connections.push_back(current->data);
-        }
-        current = current->next;
-    }
-    return connections;
-}
-
-wxString GetAssetNameById(const wxString& assetId) {
-    Node<Aset>* current = daftarAset.getHead();
-    while (current) {
-        if (current->data.id == assetId) {
-            return current->data.nama;
-        }
-        current = current->next;
-    }
-    return assetId; // Return ID if name not found
-}
-
-wxString GenerateUniqueSubAssetId(const wxString& parentId, const wxString& type = "SUB") {
-    int count = 0;
-    Node<SubAsset>* current = daftarSubAset.getHead();
-    while (current) {
-        if (current->data.parentId == parentId) {
-            count++;
-        }
-        current = current->next;
-    }
-
-    count++; // next ID
-    std::ostringstream oss;
-    oss << parentId << "-" << type << std::setw(3) << std::setfill('0') << count;
-    return wxString(oss.str());
-}
-
-AssetTree<SubAsset>* getOrCreateAssetTree(const wxString& assetId) {
-    // Find existing tree
-    Node<AssetTree<SubAsset>*>* current = assetTrees.getHead();
-    while (current) {
-        if (current->data->getRoot() && current->data->getRoot()->data.parentId == assetId) {
-            return current->data;
-        }
-        current = current->next;
-    }
-
-    // Create new tree
-    AssetTree<SubAsset>* newTree = new AssetTree<SubAsset>();
-    // Create root node for the main asset
-    SubAsset rootData("ROOT-" + assetId, "Root of " + GetAssetNameById(assetId), assetId);
-    TreeNode<SubAsset>* rootNode = new TreeNode<SubAsset>(rootData);
-    newTree->setRoot(rootNode);
-    assetTrees.push_back(newTree);
-
-    return newTree;
-}
-
-void AddSubAsset(const wxString& parentAssetId, const wxString& parentSubAssetId,
-    const wxString& nama, const wxString& description) {
-    wxString subAssetId = GenerateUniqueSubAssetId(parentAssetId);
-    SubAsset newSubAsset(subAssetId, nama, parentAssetId, description);
-
-    daftarSubAset.push_back(newSubAsset);
-
-    AssetTree<SubAsset>* tree = getOrCreateAssetTree(parentAssetId);
-    TreeNode<SubAsset>* newNode = new TreeNode<SubAsset>(newSubAsset);
-
-    if (parentSubAssetId.IsEmpty() || parentSubAssetId == "ROOT-" + parentAssetId) {
-        // Add to root
-        tree->getRoot()->addChild(newNode);
-    }
-    else {
-        // Find parent sub-asset node
-        TreeNode<SubAsset>* parentNode = tree->findNode(parentSubAssetId);
-        if (parentNode) {
-            parentNode->addChild(newNode);
-        }
-        else {
-            // Fallback to root if parent not found
-            tree->getRoot()->addChild(newNode);
-        }
-    }
-}
-
-void DeleteSubAsset(const wxString& subAssetId) {
-    // Remove from linked list
-    daftarSubAset.remove_if([&subAssetId](const SubAsset& sa) {
-        return sa.id == subAssetId;
-        });
-
-    // Remove from tree
-    Node<AssetTree<SubAsset>*>* treeNode = assetTrees.getHead();
-    while (treeNode) {
-        TreeNode<SubAsset>* nodeToDelete = treeNode->data->findNode(subAssetId);
-        if (nodeToDelete && nodeToDelete->parent) {
-            nodeToDelete->parent->removeChild(nodeToDelete);
-            delete nodeToDelete;
-            break;
-        }
-        treeNode = treeNode->next;
-    }
-}
-
-std::vector<SubAsset> GetSubAssetsForAsset(const wxString& assetId) {
-    std::vector<SubAsset> result;
-    Node<SubAsset>* current = daftarSubAset.getHead();
-    while (current) {
-        if (current->data.parentId == assetId) {
-            result.push_back(current->data);
-        }
-        current = current->next;
-    }
-    return result;
-}
-
-void UpdateSubAssetRental(const wxString& subAssetId, bool isRented,
-    const wxString& renterName, int rentalPrice) {
-    Node<SubAsset>* current = daftarSubAset.getHead();
-    while (current) {
-        if (current->data.id == subAssetId) {
-            current->data.isRented = isRented;
-            current->data.renterName = renterName;
-            current->data.rentalPrice = rentalPrice;
-            break;
-        }
-        current = current->next;
-    }
-}
-
-wxString GenerateUniqueTenderProjectId() {
-    static int counter = 1;
-    std::ostringstream oss;
-    oss << "TNR" << std::setfill('0') << std::setw(4) << counter++;
-    return wxString(oss.str());
-}
-
-void AddTenderProject(const wxString& nama, const wxString& kategori,
-    const wxString& description, const wxString& tenderDate,
-    int estimatedValue, const wxString& clientName, int priority) {
-    wxString id = GenerateUniqueTenderProjectId();
-    TenderProject newProject(id, nama, kategori, description, "Pending",
-        tenderDate, estimatedValue, clientName, priority);
-    queueTenderProjects.enqueue(newProject);
-}
-
-void DeleteTenderProject(const wxString& projectId) {
-    queueTenderProjects.remove_if([&projectId](const TenderProject& project) {
-        return project.id == projectId;
-        });
-}
-
-void UpdateTenderProjectStatus(const wxString& projectId, const wxString& newStatus) {
-    for (auto it = queueTenderProjects.begin(); it != queueTenderProjects.end(); ++it) {
-        if ((*it).id == projectId) {
-            (*it).status = newStatus;
-            break;
-        }
-    }
-}
-
-// NEW: Asset History Helper Functions
-wxString GetCurrentTimeString() {
-    wxDateTime now = wxDateTime::Now();
-    return now.Format("%d/%m/%Y %H:%M");
-}
-
-void AddToAssetHistory(const wxString& assetId, const wxString& assetName, const wxString& assetType) {
-    // Cek apakah aset yang sama sudah ada di top stack
-    AssetHistory* topItem = assetHistoryStack.peek();
-    if (topItem && topItem->assetId == assetId) {
-        return; // Jangan tambah duplikat berturut-turut
-    }
-
-    // Hapus item yang sama dari stack (jika ada)
-    Stack<AssetHistory> tempStack;
-    while (!assetHistoryStack.empty()) {
-        AssetHistory* item = assetHistoryStack.peek();
-        if (item->assetId != assetId) {
-            tempStack.push(*item);
-        }
-        assetHistoryStack.pop();
-    }
-
-    // Kembalikan item ke stack (kecuali yang duplikat)
-    while (!tempStack.empty()) {
-        AssetHistory* item = tempStack.peek();
-        assetHistoryStack.push(*item);
-        tempStack.pop();
-    }
-
-    // Tambahkan item baru ke top
-    AssetHistory newHistory(assetId, assetName, assetType, GetCurrentTimeString());
-    assetHistoryStack.push(newHistory);
-}
-
-std::vector<AssetHistory> GetAssetHistoryVector() {
-    std::vector<AssetHistory> result;
-    for (auto& history : assetHistoryStack) {
-        result.push_back(history);
-    }
-    return result;
-}
-
-std::vector<TenderProject> GetTenderProjectsVector() {
-    std::vector<TenderProject> result;
-    for (auto it = queueTenderProjects.begin(); it != queueTenderProjects.end(); ++it) {
-        result.push_back(*it);
-    }
-    return result;
-}
-
-TenderProject* GetNextTenderProject() {
-    return queueTenderProjects.peek();
-}
-
-void ProcessNextTenderProject() {
-    queueTenderProjects.dequeue();
-}
-
 
 MainFrame::MainFrame(const wxString& title)
-    : wxFrame(nullptr, wxID_ANY, title, wxDefaultPosition, wxSize(800, 600))
+    : wxFrame(nullptr, wxID_ANY, title, wxDefaultPosition, wxSize(800, 600)),
+    workerPool(new WorkerPool()), currentMenuPage(0),
+    assetIndexStamp(static_cast<unsigned long>(-1)), parentAssetPicker(nullptr),
+    treeDisplaySizer(nullptr), billingMonthDropdown(nullptr), fromAssetPicker(nullptr), toAssetPicker(nullptr),
+    selectedAssetPicker(nullptr), tenderProjectsList(nullptr), performanceList(nullptr),
+    traceButton(nullptr)
 {
     InitializeDefaultData();
 
@@ -962,22 +188,79 @@ MainFrame::MainFrame(const wxString& title)
     buttonSizer->Add(btn10, 0, wxEXPAND | wxALL, 5);
     btn10->Bind(wxEVT_BUTTON, &MainFrame::OnButtonClicked, this);
 
+    wxButton* btn11 = new wxButton(buttonPanel, 1011, "Performance");
+    buttonSizer->Add(btn11, 0, wxEXPAND | wxALL, 5);
+    btn11->Bind(wxEVT_BUTTON, &MainFrame::OnButtonClicked, this);
+
+    wxButton* btnGenerate = new wxButton(buttonPanel, 1012, "Generate Data Uji");
+    buttonSizer->Add(btnGenerate, 0, wxEXPAND | wxALL, 5);
+    btnGenerate->Bind(wxEVT_BUTTON, &MainFrame::OnGeneratePortfolio, this);
+
     buttonPanel->SetSizer(buttonSizer);
 
-    // Right panel for content
-    contentPanel = new wxPanel(panel);
-    contentSizer = new wxBoxSizer(wxVERTICAL);
-    contentPanel->SetSizer(contentSizer);
+    // Right side: satu halaman per menu (index = nomor menu, 0 untuk "Coming Soon").
+    // Halaman dibuat sekali dan hanya dibangun ulang jika datanya berubah.
+    const unsigned pageDependencies[] = {
+        0,                                              // 0 - Coming Soon
+        DATA_KATEGORI,                                  // 1 - Manajemen Kategori
+        DATA_KATEGORI,                                  // 2 - Manajemen Aset
+        DATA_ASET,                                      // 3 - Daftar Aset
+        0,                                              // 4 - Pencarian Aset
+        DATA_KATEGORI | DATA_ASET | DATA_NILAI_ASET |
+            DATA_KONEKSI | DATA_SUB_ASET | DATA_HISTORY |
+            DATA_TENDER,                                // 5 - Statistik (termasuk memori)
+        DATA_ASET | DATA_NILAI_ASET,                    // 6 - Manajemen Harga
+        DATA_ASET | DATA_KONEKSI,                       // 7 - Hubungkan Aset
+        DATA_ASET | DATA_SUB_ASET,                      // 8 - Tree SubAset
+        DATA_KATEGORI,                                  // 9 - Manajemen Tender (list queue update sendiri)
+        DATA_HISTORY,                                   // 10 - History Stack
+        0                                               // 11 - Performance (tabel di-refresh saat dibuka)
+    };
+
+    pageBook = new wxSimplebook(panel);
+    for (unsigned dependencies : pageDependencies) {
+        PageCacheEntry page;
+        page.panel = new wxPanel(pageBook);
+        page.sizer = new wxBoxSizer(wxVERTICAL);
+        page.panel->SetSizer(page.sizer);
+        page.dependencies = dependencies;
+        page.built = false;
+        page.builtStamp = 0;
+        pageBook->AddPage(page.panel, "");
+        pageCache.push_back(page);
+        pageTasks.push_back(TaskHandle());
+    }
 
     mainSizer->Add(buttonPanel, 0, wxEXPAND | wxALL, 10);
-    mainSizer->Add(contentPanel, 1, wxEXPAND | wxALL, 10);
+    mainSizer->Add(pageBook, 1, wxEXPAND | wxALL, 10);
 
     panel->SetSizer(mainSizer);
 
+    // Status bar untuk progress operasi di background
+    CreateStatusBar();
+
     // Show default page
     ShowMenuPage(1);
 }
 
+MainFrame::~MainFrame() {
+    // Batalkan dan tunggu semua worker sebelum frame hilang
+    delete workerPool;
+}
+
+void MainFrame::MarkPageFresh(int menuNumber) {
+    PageCacheEntry& page = pageCache[menuNumber];
+    page.builtStamp = GetDataStamp(page.dependencies);
+}
+
+void MainFrame::ShowTaskProgress(const wxString& label, int percent) {
+    SetStatusText(wxString::Format("%s... %d%%", label, percent));
+}
+
+void MainFrame::ClearTaskProgress() {
+    SetStatusText("");
+}
+
 void MainFrame::ShowSubAssetManagementPage() {
     contentSizer->Clear(true);
 
@@ -989,9 +272,8 @@ void MainFrame::ShowSubAssetManagementPage() {
 
     contentSizer->Add(title, 0, wxALIGN_CENTER | wxTOP | wxBOTTOM, 15);
 
-    // Get all assets for dropdown
-    std::vector<Aset> assets = GetAssetsVector();
-    if (assets.empty()) {
+    const AssetPrefixIndex* index = GetAssetIndex();
+    if (index->GetEntryCount() == 0) {
         wxStaticText* noAssets = new wxStaticText(contentPanel, wxID_ANY,
             "Tidak ada aset yang tersedia. Tambahkan aset terlebih dahulu.");
         contentSizer->Add(noAssets, 0, wxALL | wxALIGN_CENTER, 20);
@@ -1002,17 +284,10 @@ void MainFrame::ShowSubAssetManagementPage() {
     wxStaticBox* addBox = new wxStaticBox(contentPanel, wxID_ANY, "Tambah Sub-Aset Baru");
     wxStaticBoxSizer* addSizer = new wxStaticBoxSizer(addBox, wxVERTICAL);
 
-    // Parent Asset dropdown
+    // Parent Asset picker
     wxStaticText* parentAssetLabel = new wxStaticText(contentPanel, wxID_ANY, "Pilih Aset Utama:");
-    parentAssetDropdown = new wxChoice(contentPanel, wxID_ANY);
-
-    for (const auto& asset : assets) {
-        wxString displayText = asset.id + " - " + asset.nama;
-        parentAssetDropdown->Append(displayText);
-    }
-    if (!assets.empty()) {
-        parentAssetDropdown->SetSelection(0);
-    }
+    parentAssetPicker = new AssetPicker(contentPanel, index);
+    parentAssetPicker->SelectMatch(0);
 
     // Parent Sub-Asset dropdown (for hierarchical structure)
     wxStaticText* parentSubAssetLabel = new wxStaticText(contentPanel, wxID_ANY, "Parent Sub-Aset (opsional):");
@@ -1021,7 +296,7 @@ void MainFrame::ShowSubAssetManagementPage() {
     parentSubAssetDropdown->SetSelection(0);
 
     // Update parent sub-asset dropdown when parent asset changes
-    parentAssetDropdown->Bind(wxEVT_CHOICE, [this](wxCommandEvent&) {
+    parentAssetPicker->Bind(wxEVT_CHOICE, [this](wxCommandEvent&) {
         this->UpdateParentSubAssetDropdown();
         });
 
@@ -1039,7 +314,7 @@ void MainFrame::ShowSubAssetManagementPage() {
     addSubAssetBtn->Bind(wxEVT_BUTTON, &MainFrame::OnSubmitSubAsset, this);
 
     addSizer->Add(parentAssetLabel, 0, wxTOP, 5);
-    addSizer->Add(parentAssetDropdown, 0, wxEXPAND | wxBOTTOM, 10);
+    addSizer->Add(parentAssetPicker, 0, wxEXPAND | wxBOTTOM, 10);
     addSizer->Add(parentSubAssetLabel, 0, wxTOP, 5);
     addSizer->Add(parentSubAssetDropdown, 0, wxEXPAND | wxBOTTOM, 10);
     addSizer->Add(nameLabel, 0, wxTOP, 5);
@@ -1063,28 +338,51 @@ void MainFrame::ShowSubAssetManagementPage() {
     displaySizer->Add(treeDisplayPanel, 1, wxEXPAND);
     contentSizer->Add(displaySizer, 1, wxEXPAND | wxALL, 10);
 
+    // Section 3: Monthly rental billing
+    wxStaticBox* billingBox = new wxStaticBox(contentPanel, wxID_ANY, "Tagihan Sewa Bulanan");
+    wxStaticBoxSizer* billingSizer = new wxStaticBoxSizer(billingBox, wxHORIZONTAL);
+
+    // 12 bulan terakhir, bulan ini paling atas
+    billingMonthDropdown = new wxChoice(contentPanel, wxID_ANY);
+    int year, month, day;
+    LedgerDateFromDay(LedgerToday(), year, month, day);
+    for (int i = 0; i < 12; i++) {
+        billingMonthDropdown->Append(wxString::Format("%02d/%04d", month, year),
+            new wxStringClientData(wxString::Format("%d", year * 100 + month)));
+        if (--month < 1) {
+            month = 12;
+            year--;
+        }
+    }
+    billingMonthDropdown->SetSelection(0);
+
+    wxButton* billingBtn = new wxButton(contentPanel, wxID_ANY, "Buat Tagihan (CSV)...");
+    billingBtn->Bind(wxEVT_BUTTON, &MainFrame::OnRunBilling, this);
+
+    billingSizer->Add(new wxStaticText(contentPanel, wxID_ANY, "Bulan:"), 0, wxALIGN_CENTER_VERTICAL | wxRIGHT, 5);
+    billingSizer->Add(billingMonthDropdown, 0, wxALIGN_CENTER_VERTICAL | wxRIGHT, 10);
+    billingSizer->Add(billingBtn, 0, wxALIGN_CENTER_VERTICAL);
+    contentSizer->Add(billingSizer, 0, wxEXPAND | wxALL, 10);
+
     // Initialize display
     UpdateParentSubAssetDropdown();
     DisplayAssetTrees();
 }
 
 void MainFrame::UpdateParentSubAssetDropdown() {
-    if (!parentAssetDropdown || !parentSubAssetDropdown) return;
-
-    int selection = parentAssetDropdown->GetSelection();
-    if (selection == wxNOT_FOUND) return;
+    if (!parentAssetPicker || !parentSubAssetDropdown) return;
 
-    wxString selectedText = parentAssetDropdown->GetString(selection);
-    wxString assetId = selectedText.BeforeFirst(' ');
+    wxString assetId = parentAssetPicker->GetSelectedAssetId();
+    if (assetId.IsEmpty()) return;
 
     parentSubAssetDropdown->Clear();
     parentSubAssetDropdown->Append("-- Root Level --");
 
     // Add existing sub-assets for this asset
-    std::vector<SubAsset> subAssets = GetSubAssetsForAsset(assetId);
-    for (const auto& subAsset : subAssets) {
-        wxString displayText = subAsset.id + " - " + subAsset.nama;
-        parentSubAssetDropdown->Append(displayText);
+    for (const auto& subAsset : GetSubAssetsForAsset(assetId)) {
+        wxString subAssetId = GetSubAssetId(subAsset.key);
+        wxString displayText = subAssetId + " - " + subAsset.nama;
+        parentSubAssetDropdown->Append(displayText, new wxStringClientData(subAssetId));
     }
 
     parentSubAssetDropdown->SetSelection(0);
@@ -1092,33 +390,72 @@ void MainFrame::UpdateParentSubAssetDropdown() {
 
 void MainFrame::DisplayAssetTrees() {
     if (!treeDisplaySizer) return;
+    PERF_SCOPE("DisplayAssetTrees");
 
     treeDisplaySizer->Clear(true);
+    treeDisplaySizer->Add(new wxStaticText(treeDisplayPanel, wxID_ANY,
+        "Memuat struktur sub-aset..."), 0, wxALL, 20);
+    treeDisplayPanel->Layout();
 
-    std::vector<Aset> assets = GetAssetsVector();
+    // Susun baris di worker, widget dibuat setelah hasil kembali ke UI thread
+    pageTasks[8].Cancel();
+    pageTasks[8] = workerPool->Submit<std::vector<TreeDisplayRow>>(this,
+        [](TaskContext& context) {
+            RegistryReadLock lock;
+            return BuildTreeDisplayRows(&context);
+        },
+        [this](std::vector<TreeDisplayRow>& rows) {
+            ClearTaskProgress();
+            ShowTreeDisplayRows(rows);
+        },
+        [this](int percent) { ShowTaskProgress("Memuat tree sub-aset", percent); });
+}
+
+void MainFrame::ShowTreeDisplayRows(const std::vector<TreeDisplayRow>& rows) {
+    PERF_SCOPE("DisplayAssetTrees/widget");
+    treeDisplaySizer->Clear(true);
 
-    for (const auto& asset : assets) {
-        std::vector<SubAsset> subAssets = GetSubAssetsForAsset(asset.id);
-        if (!subAssets.empty()) {
-            // Asset header
-            wxString headerText = wxString::Format(" %s (%s)", asset.nama, asset.id);
-            wxStaticText* header = new wxStaticText(treeDisplayPanel, wxID_ANY, headerText);
+    for (const auto& row : rows) {
+        if (row.kind == TREE_ROW_HEADER) {
+            wxStaticText* header = new wxStaticText(treeDisplayPanel, wxID_ANY, row.text);
             wxFont headerFont = header->GetFont();
             headerFont.SetWeight(wxFONTWEIGHT_BOLD);
             headerFont.SetPointSize(headerFont.GetPointSize() + 1);
             header->SetFont(headerFont);
             treeDisplaySizer->Add(header, 0, wxALL, 5);
-
-            // Display tree structure
-            AssetTree<SubAsset>* tree = getOrCreateAssetTree(asset.id);
-            if (tree->getRoot()) {
-                DisplayTreeNode(tree->getRoot(), 1);
-            }
-
-            // Add separator
+        }
+        else if (row.kind == TREE_ROW_SEPARATOR) {
             wxStaticLine* separator = new wxStaticLine(treeDisplayPanel);
             treeDisplaySizer->Add(separator, 0, wxEXPAND | wxTOP | wxBOTTOM, 10);
         }
+        else {
+            wxBoxSizer* nodeSizer = new wxBoxSizer(wxHORIZONTAL);
+            wxStaticText* nodeLabel = new wxStaticText(treeDisplayPanel, wxID_ANY, row.text);
+
+            // Action buttons
+            wxButton* editBtn = new wxButton(treeDisplayPanel, wxID_ANY, "Edit",
+                wxDefaultPosition, wxSize(50, 25));
+            wxButton* moveBtn = new wxButton(treeDisplayPanel, wxID_ANY, "Pindah",
+                wxDefaultPosition, wxSize(55, 25));
+            wxButton* deleteBtn = new wxButton(treeDisplayPanel, wxID_ANY, "Hapus",
+                wxDefaultPosition, wxSize(50, 25));
+
+            // Store node data in buttons
+            editBtn->SetClientObject(new wxStringClientData(row.subAssetId));
+            moveBtn->SetClientObject(new wxStringClientData(row.subAssetId));
+            deleteBtn->SetClientObject(new wxStringClientData(row.subAssetId));
+
+            editBtn->Bind(wxEVT_BUTTON, &MainFrame::OnEditSubAsset, this);
+            moveBtn->Bind(wxEVT_BUTTON, &MainFrame::OnMoveSubAsset, this);
+            deleteBtn->Bind(wxEVT_BUTTON, &MainFrame::OnDeleteSubAsset, this);
+
+            nodeSizer->Add(nodeLabel, 1, wxALIGN_CENTER_VERTICAL | wxRIGHT, 10);
+            nodeSizer->Add(editBtn, 0, wxRIGHT, 5);
+            nodeSizer->Add(moveBtn, 0, wxRIGHT, 5);
+            nodeSizer->Add(deleteBtn, 0);
+
+            treeDisplaySizer->Add(nodeSizer, 0, wxEXPAND | wxALL, 2);
+        }
     }
 
     if (treeDisplaySizer->GetItemCount() == 0) {
@@ -1131,62 +468,8 @@ void MainFrame::DisplayAssetTrees() {
     treeDisplayPanel->FitInside();
 }
 
-void MainFrame::DisplayTreeNode(TreeNode<SubAsset>* node, int depth) {
-    if (!node) return;
-
-    // Skip root node display
-    if (depth > 1 || !node->data.id.StartsWith("ROOT-")) {
-        wxBoxSizer* nodeSizer = new wxBoxSizer(wxHORIZONTAL);
-
-        // Indentation
-        wxString indent = wxString(' ', (depth - 1) * 4);
-        wxString prefix = depth > 1 ? "|-- " : "+-- ";
-        // Node info
-        wxString nodeText = indent + prefix;
-        if (node->data.isRented) {
-            nodeText += "[R] ";  // [R] for Rented
-        }
-        else {
-            nodeText += "[A] ";  // [A] for Asset
-        }
-        nodeText += node->data.nama + " (" + node->data.id + ")";
-
-        if (node->data.isRented) {
-            nodeText += wxString::Format(" - Disewa: %s (Rp %d)",
-                node->data.renterName, node->data.rentalPrice);
-        }
-
-        wxStaticText* nodeLabel = new wxStaticText(treeDisplayPanel, wxID_ANY, nodeText);
-
-        // Action buttons
-        wxButton* editBtn = new wxButton(treeDisplayPanel, wxID_ANY, "Edit",
-            wxDefaultPosition, wxSize(50, 25));
-        wxButton* deleteBtn = new wxButton(treeDisplayPanel, wxID_ANY, "Hapus",
-            wxDefaultPosition, wxSize(50, 25));
-
-        // Store node data in buttons
-        editBtn->SetClientData(new wxString(node->data.id));
-        deleteBtn->SetClientData(new wxString(node->data.id));
-
-        editBtn->Bind(wxEVT_BUTTON, &MainFrame::OnEditSubAsset, this);
-        deleteBtn->Bind(wxEVT_BUTTON, &MainFrame::OnDeleteSubAsset, this);
-
-        nodeSizer->Add(nodeLabel, 1, wxALIGN_CENTER_VERTICAL | wxRIGHT, 10);
-        nodeSizer->Add(editBtn, 0, wxRIGHT, 5);
-        nodeSizer->Add(deleteBtn, 0);
-
-        treeDisplaySizer->Add(nodeSizer, 0, wxEXPAND | wxALL, 2);
-    }
-
-    // Display children
-    Node<TreeNode<SubAsset>*>* child = node->children.getHead();
-    while (child) {
-        DisplayTreeNode(child->data, depth + 1);
-        child = child->next;
-    }
-}
-
 void MainFrame::OnSubmitSubAsset(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnSubmitSubAsset");
     wxString subAssetName = subAssetNameInput->GetValue().Trim();
     wxString description = subAssetDescInput->GetValue().Trim();
 
@@ -1195,20 +478,18 @@ void MainFrame::OnSubmitSubAsset(wxCommandEvent& event) {
         return;
     }
 
-    int assetSelection = parentAssetDropdown->GetSelection();
-    if (assetSelection == wxNOT_FOUND) {
+    wxString assetId = parentAssetPicker->GetSelectedAssetId();
+    if (assetId.IsEmpty()) {
         wxMessageBox("Pilih aset utama.", "Error", wxOK | wxICON_ERROR);
         return;
     }
 
-    wxString assetText = parentAssetDropdown->GetString(assetSelection);
-    wxString assetId = assetText.BeforeFirst(' ');
-
     wxString parentSubAssetId = "";
     int subAssetSelection = parentSubAssetDropdown->GetSelection();
     if (subAssetSelection > 0) { // Not "-- Root Level --"
-        wxString subAssetText = parentSubAssetDropdown->GetString(subAssetSelection);
-        parentSubAssetId = subAssetText.BeforeFirst(' ');
+        wxStringClientData* data = static_cast<wxStringClientData*>(
+            parentSubAssetDropdown->GetClientObject(subAssetSelection));
+        parentSubAssetId = data->GetData();
     }
 
     AddSubAsset(assetId, parentSubAssetId, subAssetName, description);
@@ -1223,25 +504,22 @@ void MainFrame::OnSubmitSubAsset(wxCommandEvent& event) {
     // Refresh display
     UpdateParentSubAssetDropdown();
     DisplayAssetTrees();
+    MarkPageFresh(8);
 }
 
 void MainFrame::OnEditSubAsset(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnEditSubAsset");
     wxButton* btn = dynamic_cast<wxButton*>(event.GetEventObject());
     if (!btn) return;
 
-    wxString* subAssetId = static_cast<wxString*>(btn->GetClientData());
-    if (!subAssetId) return;
+    wxStringClientData* data = static_cast<wxStringClientData*>(btn->GetClientObject());
+    if (!data) return;
+    wxString subAssetId = data->GetData();
 
     // Find the sub-asset
-    Node<SubAsset>* current = daftarSubAset.getHead();
-    SubAsset* targetSubAsset = nullptr;
-    while (current) {
-        if (current->data.id == *subAssetId) {
-            targetSubAsset = &current->data;
-            break;
-        }
-        current = current->next;
-    }
+    EntityKey subAssetKey;
+    if (!subAssetKeys.Find(subAssetId, subAssetKey)) return;
+    SubAsset* targetSubAsset = findSubAsset(subAssetKey);
 
     if (!targetSubAsset) {
         wxMessageBox("Sub-aset tidak ditemukan.", "Error", wxOK | wxICON_ERROR);
@@ -1289,38 +567,178 @@ void MainFrame::ShowEditSubAssetDialog(SubAsset* subAsset) {
     dlg.CenterOnParent();
 
     if (dlg.ShowModal() == wxID_OK) {
-        subAsset->nama = nameCtrl->GetValue().Trim();
-        subAsset->description = descCtrl->GetValue().Trim();
-        subAsset->isRented = rentalCheck->GetValue();
-        subAsset->renterName = renterCtrl->GetValue().Trim();
+        {
+            RegistryWriteLock lock(DATA_SUB_ASET);
+            subAsset->nama = nameCtrl->GetValue().Trim();
+            subAsset->description = descCtrl->GetValue().Trim();
+        }
 
+        // Status sewa lewat engine agar rollup okupansi ancestor ikut diperbarui
         long price;
+        int rentalPrice = subAsset->rentalPrice;
         if (priceCtrl->GetValue().ToLong(&price)) {
-            subAsset->rentalPrice = (int)price;
+            rentalPrice = (int)price;
         }
+        UpdateSubAssetRental(GetSubAssetId(subAsset->key), rentalCheck->GetValue(),
+            renterCtrl->GetValue().Trim(), rentalPrice);
 
         wxMessageBox("Sub-aset berhasil diperbarui.", "Sukses", wxOK | wxICON_INFORMATION);
         DisplayAssetTrees();
     }
-    AddToAssetHistory(subAsset->id, subAsset->nama, "SubAsset");
+    AddToAssetHistory(GetSubAssetId(subAsset->key), subAsset->nama, "SubAsset");
+}
+
+void MainFrame::OnMoveSubAsset(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnMoveSubAsset");
+    wxButton* btn = dynamic_cast<wxButton*>(event.GetEventObject());
+    if (!btn) return;
+
+    wxStringClientData* data = static_cast<wxStringClientData*>(btn->GetClientObject());
+    if (!data) return;
+    ShowMoveSubAssetDialog(data->GetData());
+}
+
+void MainFrame::OnRunBilling(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnRunBilling");
+    if (!billingMonthDropdown || billingMonthDropdown->GetSelection() == wxNOT_FOUND) return;
+    if (billingTask.IsRunning()) {
+        wxMessageBox("Tagihan sebelumnya masih diproses.", "Info", wxOK | wxICON_INFORMATION);
+        return;
+    }
+
+    wxStringClientData* data = static_cast<wxStringClientData*>(
+        billingMonthDropdown->GetClientObject(billingMonthDropdown->GetSelection()));
+    long period = 0;
+    if (!data || !data->GetData().ToLong(&period)) return;
+    int year = static_cast<int>(period / 100);
+    int month = static_cast<int>(period % 100);
+
+    wxFileDialog dialog(this, "Simpan Tagihan", "", wxString::Format("tagihan-sewa-%04d-%02d.csv", year, month),
+        "CSV (*.csv)|*.csv", wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+    if (dialog.ShowModal() != wxID_OK) return;
+    std::string path = dialog.GetPath().ToStdString();
+
+    // Hitung paralel di pool di bawah read lock; file ditulis setelah lock dilepas
+    struct BillingSummary {
+        bool cancelled;
+        bool written;
+        size_t lines;
+        size_t proratedLines;
+        size_t renters;
+        long long totalAmount;
+    };
+    WorkerPool* pool = workerPool;
+    billingTask = workerPool->Submit<BillingSummary>(this,
+        [pool, year, month, path](TaskContext& context) {
+            BillingRun run;
+            {
+                RegistryReadLock lock;
+                run = RunMonthlyBilling(year, month, pool, &context);
+            }
+            BillingSummary summary = { run.cancelled, false, run.lines.size(), run.proratedLines,
+                run.renters.size(), run.totalAmount };
+            if (!run.cancelled) summary.written = WriteBillingRun(run, path);
+            return summary;
+        },
+        [this, year, month](BillingSummary& summary) {
+            ClearTaskProgress();
+            if (summary.cancelled) return;
+            if (!summary.written) {
+                wxMessageBox("Gagal menulis file tagihan.", "Error", wxOK | wxICON_ERROR);
+                return;
+            }
+            wxMessageBox(wxString::Format("Tagihan %02d/%04d: %zu baris (%zu prorata), %zu penyewa.\n"
+                "Total: Rp %lld", month, year, summary.lines, summary.proratedLines, summary.renters,
+                summary.totalAmount), "Tagihan Sewa", wxOK | wxICON_INFORMATION);
+        },
+        [this](int percent) { ShowTaskProgress("Membuat tagihan sewa", percent); });
+}
+
+void MainFrame::ShowMoveSubAssetDialog(const wxString& subAssetId) {
+    EntityKey subAssetKey;
+    if (!subAssetKeys.Find(subAssetId, subAssetKey) || !findSubAsset(subAssetKey)) {
+        wxMessageBox("Sub-aset tidak ditemukan.", "Error", wxOK | wxICON_ERROR);
+        return;
+    }
+
+    wxDialog dlg(this, wxID_ANY, "Pindah Sub-Aset: " + subAssetId,
+        wxDefaultPosition, wxSize(400, 400));
+    wxBoxSizer* sizer = new wxBoxSizer(wxVERTICAL);
+
+    // Target asset
+    sizer->Add(new wxStaticText(&dlg, wxID_ANY, "Aset Tujuan:"), 0, wxALL, 5);
+    AssetPicker* assetPicker = new AssetPicker(&dlg, GetAssetIndex());
+    assetPicker->SelectMatch(0);
+    sizer->Add(assetPicker, 0, wxEXPAND | wxALL, 5);
+
+    // Target parent; subtree sub-aset ini sendiri tidak ditawarkan
+    sizer->Add(new wxStaticText(&dlg, wxID_ANY, "Parent Sub-Aset Baru:"), 0, wxALL, 5);
+    wxChoice* parentChoice = new wxChoice(&dlg, wxID_ANY);
+    sizer->Add(parentChoice, 0, wxEXPAND | wxALL, 5);
+
+    auto fillParents = [assetPicker, parentChoice, subAssetKey]() {
+        parentChoice->Clear();
+        parentChoice->Append("-- Root Level --");
+        wxString assetId = assetPicker->GetSelectedAssetId();
+        if (!assetId.IsEmpty()) {
+            for (const auto& subAsset : GetSubAssetsForAsset(assetId)) {
+                if (IsSubAssetUnder(subAsset.key, subAssetKey)) continue;
+                wxString id = GetSubAssetId(subAsset.key);
+                parentChoice->Append(id + " - " + subAsset.nama, new wxStringClientData(id));
+            }
+        }
+        parentChoice->SetSelection(0);
+    };
+    fillParents();
+    assetPicker->Bind(wxEVT_CHOICE, [fillParents](wxCommandEvent&) { fillParents(); });
+
+    sizer->Add(dlg.CreateButtonSizer(wxOK | wxCANCEL), 0, wxALL | wxALIGN_CENTER, 10);
+    dlg.SetSizer(sizer);
+    dlg.CenterOnParent();
+
+    if (dlg.ShowModal() != wxID_OK) return;
+
+    wxString assetId = assetPicker->GetSelectedAssetId();
+    if (assetId.IsEmpty()) {
+        wxMessageBox("Pilih aset tujuan.", "Error", wxOK | wxICON_ERROR);
+        return;
+    }
+    wxString parentSubAssetId = "";
+    int selection = parentChoice->GetSelection();
+    if (selection > 0) {
+        wxStringClientData* data = static_cast<wxStringClientData*>(parentChoice->GetClientObject(selection));
+        parentSubAssetId = data->GetData();
+    }
+
+    if (!MoveSubAsset(subAssetId, assetId, parentSubAssetId)) {
+        wxMessageBox("Sub-aset tidak dapat dipindahkan ke tujuan tersebut.", "Error", wxOK | wxICON_ERROR);
+        return;
+    }
+
+    wxMessageBox("Sub-aset berhasil dipindahkan.", "Sukses", wxOK | wxICON_INFORMATION);
+    UpdateParentSubAssetDropdown();
+    DisplayAssetTrees();
+    MarkPageFresh(8);
+    if (SubAsset* moved = findSubAsset(subAssetKey)) {
+        AddToAssetHistory(subAssetId, moved->nama, "SubAsset");
+    }
 }
 
 void MainFrame::OnDeleteSubAsset(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnDeleteSubAsset");
     wxButton* btn = dynamic_cast<wxButton*>(event.GetEventObject());
     if (!btn) return;
 
-    wxString* subAssetId = static_cast<wxString*>(btn->GetClientData());
-    if (!subAssetId) return;
+    wxStringClientData* data = static_cast<wxStringClientData*>(btn->GetClientObject());
+    if (!data) return;
+    wxString subAssetId = data->GetData();
 
     // Find sub-asset name for confirmation
-    wxString subAssetName = *subAssetId;
-    Node<SubAsset>* current = daftarSubAset.getHead();
-    while (current) {
-        if (current->data.id == *subAssetId) {
-            subAssetName = current->data.nama;
-            break;
-        }
-        current = current->next;
+    wxString subAssetName = subAssetId;
+    EntityKey subAssetKey = NO_ENTITY_KEY;
+    subAssetKeys.Find(subAssetId, subAssetKey);
+    if (SubAsset* subAsset = findSubAsset(subAssetKey)) {
+        subAssetName = subAsset->nama;
     }
 
     int result = wxMessageBox(
@@ -1329,27 +747,23 @@ void MainFrame::OnDeleteSubAsset(wxCommandEvent& event) {
         "Konfirmasi Hapus", wxYES_NO | wxICON_QUESTION);
 
     if (result == wxYES) {
-        DeleteSubAsset(*subAssetId);
+        DeleteSubAsset(subAssetId);
         wxMessageBox("Sub-aset berhasil dihapus.", "Sukses", wxOK | wxICON_INFORMATION);
         UpdateParentSubAssetDropdown();
         DisplayAssetTrees();
+        MarkPageFresh(8);
     }
 }
 
 
 void MainFrame::ShowAssetValueManagementPanel() {
-    contentPanel->DestroyChildren();
-
-    wxBoxSizer* vSizer = new wxBoxSizer(wxVERTICAL);
-
-
     // Header
     wxStaticText* header = new wxStaticText(contentPanel, wxID_ANY, "Manajemen Harga Aset");
     wxFont headerFont = header->GetFont();
     headerFont.SetPointSize(16);
     headerFont.SetWeight(wxFONTWEIGHT_BOLD);
     header->SetFont(headerFont);
-    vSizer->Add(header, 0, wxALL | wxALIGN_CENTER, 10);
+    contentSizer->Add(header, 0, wxALL | wxALIGN_CENTER, 10);
 
     // Ensure asset values are initialized
     initializeAssetValues(daftarAset, daftarDetailNilaiAset);
@@ -1358,15 +772,15 @@ void MainFrame::ShowAssetValueManagementPanel() {
     Node<AssetValueDetails>* current = daftarDetailNilaiAset.getHead();
     while (current) {
         wxString info = wxString::Format("ID: %s | Harga: %d | Maintenance: %d | Pajak: %d",
-            current->data.assetId,
+            GetAssetId(current->data.assetKey),
             current->data.currentValue,
             current->data.maintenanceCost,
             current->data.propertyTax);
         wxStaticText* stat = new wxStaticText(contentPanel, wxID_ANY, info);
-        vSizer->Add(stat, 0, wxALL, 5);
+        contentSizer->Add(stat, 0, wxALL, 5);
 
-        wxButton* editBtn = new wxButton(contentPanel, wxID_ANY, "Edit " + current->data.assetId);
-        vSizer->Add(editBtn, 0, wxALL, 5);
+        wxButton* editBtn = new wxButton(contentPanel, wxID_ANY, "Edit " + GetAssetId(current->data.assetKey));
+        contentSizer->Add(editBtn, 0, wxALL, 5);
 
         editBtn->Bind(wxEVT_BUTTON, [this, node = current](wxCommandEvent&) {
             this->ShowEditAssetValueDialog(node);
@@ -1374,28 +788,11 @@ void MainFrame::ShowAssetValueManagementPanel() {
 
         current = current->next;
     }
-
-    contentPanel->SetSizer(vSizer);
-    contentPanel->Layout();
 }
 
 void MainFrame::ShowEditAssetValueDialog(Node<AssetValueDetails>* node) {
-    wxString assetName = node->data.assetId;
-
-    for (auto it = daftarAset.begin(); it != daftarAset.end(); ++it) {
-        if ((*it).id == node->data.assetId) {
-            assetName = (*it).nama;
-            break;
-        }
-    }
-
-    for (auto& aset : daftarAset) {
-        if (aset.id == node->data.assetId) {
-            assetName = aset.nama;
-            break;
-        }
-    }
-    AddToAssetHistory(node->data.assetId, assetName, "Asset Value");
+    wxString assetName = GetAssetNameByKey(node->data.assetKey);
+    AddToAssetHistory(GetAssetId(node->data.assetKey), assetName, "Asset Value");
 
 
     wxDialog dlg(this, wxID_ANY, "Edit Harga Aset: " + assetName, wxDefaultPosition, wxSize(400, 300));
@@ -1424,12 +821,15 @@ void MainFrame::ShowEditAssetValueDialog(Node<AssetValueDetails>* node) {
             txtMaint->GetValue().ToLong(&valMaint) &&
             txtPajak->GetValue().ToLong(&valPajak)) {
 
-            node->data.currentValue = (int)valHarga;
-            node->data.maintenanceCost = (int)valMaint;
-            node->data.propertyTax = (int)valPajak;
+            {
+                RegistryWriteLock lock(DATA_NILAI_ASET);
+                node->data.currentValue = (int)valHarga;
+                node->data.maintenanceCost = (int)valMaint;
+                node->data.propertyTax = (int)valPajak;
+            }
 
             wxMessageBox("Data harga aset berhasil diperbarui.", "Sukses", wxOK | wxICON_INFORMATION);
-            ShowAssetValueManagementPanel();
+            ShowMenuPage(6);
         }
         else {
             wxMessageBox("Input tidak valid.", "Error", wxOK | wxICON_ERROR);
@@ -1452,37 +852,23 @@ void MainFrame::ShowAssetGraphManagementPage() {
     wxStaticBox* addBox = new wxStaticBox(contentPanel, wxID_ANY, "Tambah Koneksi Baru");
     wxStaticBoxSizer* addSizer = new wxStaticBoxSizer(addBox, wxVERTICAL);
 
-    // Get all assets for dropdowns
-    std::vector<Aset> assets = GetAssetsVector();
-    if (assets.empty()) {
+    const AssetPrefixIndex* index = GetAssetIndex();
+    if (index->GetEntryCount() == 0) {
         wxStaticText* noAssets = new wxStaticText(contentPanel, wxID_ANY,
             "Tidak ada aset yang tersedia. Tambahkan aset terlebih dahulu.");
         contentSizer->Add(noAssets, 0, wxALL | wxALIGN_CENTER, 20);
         return;
     }
 
-    wxString* assetArray = new wxString[assets.size()];
-    for (size_t i = 0; i < assets.size(); i++) {
-        assetArray[i] = assets[i].id + " - " + assets[i].nama;
-    }
-
-    // From Asset dropdown
+    // From Asset picker
     wxStaticText* fromLabel = new wxStaticText(contentPanel, wxID_ANY, "Aset Asal:");
-    fromAssetDropdown = new wxChoice(contentPanel, wxID_ANY, wxDefaultPosition, wxDefaultSize,
-        static_cast<int>(assets.size()), assetArray);
-    if (assets.size() > 0) {
-        fromAssetDropdown->SetSelection(0);
-    }
+    fromAssetPicker = new AssetPicker(contentPanel, index);
+    fromAssetPicker->SelectMatch(0);
 
-    // To Asset dropdown
+    // To Asset picker
     wxStaticText* toLabel = new wxStaticText(contentPanel, wxID_ANY, "Aset Tujuan:");
-    toAssetDropdown = new wxChoice(contentPanel, wxID_ANY, wxDefaultPosition, wxDefaultSize,
-        static_cast<int>(assets.size()), assetArray);
-    if (assets.size() > 1) {
-        toAssetDropdown->SetSelection(1);
-    }
-
-    delete[] assetArray;
+    toAssetPicker = new AssetPicker(contentPanel, index);
+    toAssetPicker->SelectMatch(1);
 
     // Weight input
     wxStaticText* weightLabel = new wxStaticText(contentPanel, wxID_ANY, "Bobot Koneksi:");
@@ -1497,9 +883,9 @@ void MainFrame::ShowAssetGraphManagementPage() {
     addConnectionBtn->Bind(wxEVT_BUTTON, &MainFrame::OnSubmitConnection, this);
 
     addSizer->Add(fromLabel, 0, wxTOP, 5);
-    addSizer->Add(fromAssetDropdown, 0, wxEXPAND | wxBOTTOM, 10);
+    addSizer->Add(fromAssetPicker, 0, wxEXPAND | wxBOTTOM, 10);
     addSizer->Add(toLabel, 0, wxTOP, 5);
-    addSizer->Add(toAssetDropdown, 0, wxEXPAND | wxBOTTOM, 10);
+    addSizer->Add(toAssetPicker, 0, wxEXPAND | wxBOTTOM, 10);
     addSizer->Add(weightLabel, 0, wxTOP, 5);
     addSizer->Add(weightInput, 0, wxEXPAND | wxBOTTOM, 10);
     addSizer->Add(descLabel, 0, wxTOP, 5);
@@ -1514,30 +900,87 @@ void MainFrame::ShowAssetGraphManagementPage() {
 
     wxStaticText* selectLabel = new wxStaticText(contentPanel, wxID_ANY, "Pilih Aset:");
 
-    // Recreate asset array for the third dropdown
-    wxString* assetArray2 = new wxString[assets.size()];
-    for (size_t i = 0; i < assets.size(); i++) {
-        assetArray2[i] = assets[i].id + " - " + assets[i].nama;
-    }
-
-    selectedAssetDropdown = new wxChoice(contentPanel, wxID_ANY, wxDefaultPosition, wxDefaultSize,
-        static_cast<int>(assets.size()), assetArray2);
-    if (assets.size() > 0) {
-        selectedAssetDropdown->SetSelection(0);
-    }
-
-    delete[] assetArray2;
+    selectedAssetPicker = new AssetPicker(contentPanel, index);
+    selectedAssetPicker->SelectMatch(0);
 
     wxButton* viewConnectionsBtn = new wxButton(contentPanel, wxID_ANY, "Lihat Koneksi");
     viewConnectionsBtn->Bind(wxEVT_BUTTON, &MainFrame::OnViewAssetConnections, this);
 
     viewSizer->Add(selectLabel, 0, wxTOP, 5);
-    viewSizer->Add(selectedAssetDropdown, 0, wxEXPAND | wxBOTTOM, 10);
+    viewSizer->Add(selectedAssetPicker, 0, wxEXPAND | wxBOTTOM, 10);
     viewSizer->Add(viewConnectionsBtn, 0, wxALIGN_CENTER | wxTOP, 10);
 
     contentSizer->Add(viewSizer, 0, wxEXPAND | wxALL, 10);
 
-    // Section 3: Display all connections
+    // Section 3: Asset clusters (aset yang saling terhubung)
+    wxStaticBox* clusterBox = new wxStaticBox(contentPanel, wxID_ANY, "Cluster Aset");
+    wxStaticBoxSizer* clusterSizer = new wxStaticBoxSizer(clusterBox, wxVERTICAL);
+
+    const size_t CLUSTER_DISPLAY_LIMIT = 10;
+    size_t clusterCount = GetLinkedClusterCount();
+    wxStaticText* clusterSummary = new wxStaticText(contentPanel, wxID_ANY,
+        wxString::Format("%zu cluster berisi 2 aset atau lebih.", clusterCount));
+    clusterSizer->Add(clusterSummary, 0, wxTOP | wxBOTTOM, 5);
+
+    if (clusterCount > 0) {
+        wxListCtrl* clusterList = new wxListCtrl(contentPanel, wxID_ANY, wxDefaultPosition, wxSize(-1, 180),
+            wxLC_REPORT | wxLC_SINGLE_SEL);
+        clusterList->InsertColumn(0, "Wakil Cluster", wxLIST_FORMAT_LEFT, 120);
+        clusterList->InsertColumn(1, "Nama Aset", wxLIST_FORMAT_LEFT, 220);
+        clusterList->InsertColumn(2, "Jumlah Aset", wxLIST_FORMAT_RIGHT, 100);
+
+        std::vector<AssetCluster> clusters = GetAssetClusters(CLUSTER_DISPLAY_LIMIT);
+        for (size_t i = 0; i < clusters.size(); i++) {
+            long row = clusterList->InsertItem(static_cast<long>(i), GetAssetId(clusters[i].rootKey));
+            clusterList->SetItem(row, 1, GetAssetNameByKey(clusters[i].rootKey));
+            clusterList->SetItem(row, 2, wxString::Format("%u", clusters[i].size));
+        }
+        clusterSizer->Add(clusterList, 0, wxEXPAND | wxBOTTOM, 10);
+    }
+
+    wxButton* checkClusterBtn = new wxButton(contentPanel, wxID_ANY, "Cek Aset Asal && Tujuan Satu Cluster");
+    checkClusterBtn->Bind(wxEVT_BUTTON, &MainFrame::OnCheckAssetCluster, this);
+    clusterSizer->Add(checkClusterBtn, 0, wxALIGN_CENTER | wxTOP, 5);
+
+    contentSizer->Add(clusterSizer, 0, wxEXPAND | wxALL, 10);
+
+    // Section 4: Minimum spanning network (bobot = biaya koneksi)
+    wxStaticBox* networkBox = new wxStaticBox(contentPanel, wxID_ANY, "Jaringan Minimum");
+    wxStaticBoxSizer* networkSizer = new wxStaticBoxSizer(networkBox, wxVERTICAL);
+
+    // Hasil lama tidak ditandai lagi setelah aset atau koneksi berubah
+    const SpanningForest* forest = spanningForest.get();
+    if (forest && forest->dataStamp != GetDataStamp(DATA_ASET | DATA_KONEKSI)) forest = nullptr;
+
+    wxString networkText = "Pilih koneksi termurah yang menyambung semua aset yang bisa tersambung.";
+    if (forest) {
+        networkText = wxString::Format("%zu dari %zu koneksi terpilih, total bobot %lld, %zu komponen.\n"
+            "Koneksi terpilih ditandai di daftar koneksi.", forest->edges.size(), forest->consideredEdges,
+            forest->totalWeight, forest->treeCount);
+    }
+    networkSizer->Add(new wxStaticText(contentPanel, wxID_ANY, networkText), 0, wxTOP | wxBOTTOM, 5);
+
+    wxButton* networkBtn = new wxButton(contentPanel, wxID_ANY, "Hitung Jaringan Minimum");
+    networkBtn->Bind(wxEVT_BUTTON, &MainFrame::OnComputeSpanningForest, this);
+    networkSizer->Add(networkBtn, 0, wxALIGN_CENTER | wxTOP, 5);
+
+    contentSizer->Add(networkSizer, 0, wxEXPAND | wxALL, 10);
+
+    // Section 5: Graph visualization
+    wxStaticBox* canvasBox = new wxStaticBox(contentPanel, wxID_ANY, "Visualisasi Graph");
+    wxStaticBoxSizer* canvasSizer = new wxStaticBoxSizer(canvasBox, wxVERTICAL);
+
+    GraphCanvas* graphCanvas = new GraphCanvas(contentPanel, workerPool);
+    graphCanvas->SetMinSize(wxSize(-1, 400));
+    canvasSizer->Add(graphCanvas, 1, wxEXPAND);
+    contentSizer->Add(canvasSizer, 0, wxEXPAND | wxALL, 10);
+
+    std::vector<wxString> graphLabels;
+    std::vector<LayoutEdge> graphEdges;
+    BuildConnectionGraph(graphLabels, graphEdges);
+    graphCanvas->SetGraph(graphLabels, graphEdges);
+
+    // Section 6: Display all connections
     wxStaticBox* allBox = new wxStaticBox(contentPanel, wxID_ANY, "Semua Koneksi Aset");
     wxStaticBoxSizer* allSizer = new wxStaticBoxSizer(allBox, wxVERTICAL);
 
@@ -1548,7 +991,7 @@ void MainFrame::ShowAssetGraphManagementPage() {
     graphResultsPanel->SetSizer(graphResultsSizer);
 
     // Display existing connections
-    std::vector<AssetConnection> connections = GetAssetConnections();
+    ListView<AssetConnection> connections = GetAssetConnections();
 
     if (connections.empty()) {
         wxStaticText* noConnections = new wxStaticText(graphResultsPanel, wxID_ANY,
@@ -1559,8 +1002,8 @@ void MainFrame::ShowAssetGraphManagementPage() {
         for (const auto& conn : connections) {
             wxBoxSizer* connSizer = new wxBoxSizer(wxHORIZONTAL);
 
-            wxString fromName = GetAssetNameById(conn.fromAssetId);
-            wxString toName = GetAssetNameById(conn.toAssetId);
+            wxString fromName = GetAssetNameByKey(conn.fromAssetKey);
+            wxString toName = GetAssetNameByKey(conn.toAssetKey);
 
             wxString connText = wxString::Format("%s <-> %s (Bobot: %d)",
                 fromName, toName, conn.weight);
@@ -1569,11 +1012,22 @@ void MainFrame::ShowAssetGraphManagementPage() {
                 connText += " - " + conn.description;
             }
 
+            bool inNetwork = forest && forest->Contains(conn.fromAssetKey, conn.toAssetKey);
+            if (inNetwork) {
+                connText = "[Jaringan] " + connText;
+            }
+
             wxStaticText* connLabel = new wxStaticText(graphResultsPanel, wxID_ANY, connText);
+            if (inNetwork) {
+                wxFont networkFont = connLabel->GetFont();
+                networkFont.SetWeight(wxFONTWEIGHT_BOLD);
+                connLabel->SetFont(networkFont);
+                connLabel->SetForegroundColour(wxColour(0, 128, 0));
+            }
             wxButton* deleteBtn = new wxButton(graphResultsPanel, wxID_ANY, "Hapus");
 
             // Store connection info in button's client data
-            deleteBtn->SetClientData(new AssetConnection(conn));
+            deleteBtn->SetClientObject(new ConnectionClientData(conn));
             deleteBtn->Bind(wxEVT_BUTTON, &MainFrame::OnDeleteConnection, this);
 
             connSizer->Add(connLabel, 1, wxALIGN_CENTER_VERTICAL | wxRIGHT, 10);
@@ -1588,15 +1042,16 @@ void MainFrame::ShowAssetGraphManagementPage() {
 }
 
 void MainFrame::OnSubmitConnection(wxCommandEvent& event) {
-    int fromSelection = fromAssetDropdown->GetSelection();
-    int toSelection = toAssetDropdown->GetSelection();
+    TRACE_SCOPE("MainFrame::OnSubmitConnection");
+    wxString fromId = fromAssetPicker->GetSelectedAssetId();
+    wxString toId = toAssetPicker->GetSelectedAssetId();
 
-    if (fromSelection == wxNOT_FOUND || toSelection == wxNOT_FOUND) {
+    if (fromId.IsEmpty() || toId.IsEmpty()) {
         wxMessageBox("Pilih aset asal dan tujuan.", "Error", wxOK | wxICON_ERROR);
         return;
     }
 
-    if (fromSelection == toSelection) {
+    if (fromId == toId) {
         wxMessageBox("Aset asal dan tujuan harus berbeda.", "Error", wxOK | wxICON_ERROR);
         return;
     }
@@ -1608,13 +1063,6 @@ void MainFrame::OnSubmitConnection(wxCommandEvent& event) {
         return;
     }
 
-    // Extract asset IDs from dropdown selections
-    wxString fromText = fromAssetDropdown->GetString(fromSelection);
-    wxString toText = toAssetDropdown->GetString(toSelection);
-
-    wxString fromId = fromText.BeforeFirst(' ');
-    wxString toId = toText.BeforeFirst(' ');
-
     if (ConnectionExists(fromId, toId)) {
         wxMessageBox("Koneksi antara aset ini sudah ada.", "Error", wxOK | wxICON_ERROR);
         return;
@@ -1746,24 +1194,16 @@ void MainFrame::ShowTenderProjectManagementPage() {
     queueScrolledPanel->SetSizer(queueInnerSizer);
 
     // Queue Statistics
-    wxString queueStats = wxString::Format("Total Proyek dalam Queue: %zu",
-        queueTenderProjects.size());
-    queueSizer->Add(new wxStaticText(contentPanel, wxID_ANY, queueStats), 0, wxALL, 5);
+    tenderQueueCountLabel = new wxStaticText(contentPanel, wxID_ANY, "");
+    queueSizer->Add(tenderQueueCountLabel, 0, wxALL, 5);
 
     // Next Project Info
-    TenderProject* nextProject = GetNextTenderProject();
-    if (nextProject) {
-        wxString nextInfo = wxString::Format("Proyek Berikutnya: %s (%s)",
-            nextProject->nama, nextProject->id);
-        queueSizer->Add(new wxStaticText(contentPanel, wxID_ANY, nextInfo), 0, wxALL, 5);
+    tenderNextProjectLabel = new wxStaticText(contentPanel, wxID_ANY, "");
+    queueSizer->Add(tenderNextProjectLabel, 0, wxALL, 5);
 
-        wxButton* processBtn = new wxButton(contentPanel, 9002, "Proses Proyek Berikutnya");
-        processBtn->Bind(wxEVT_COMMAND_BUTTON_CLICKED, &MainFrame::OnProcessNextTenderProject, this);
-        queueSizer->Add(processBtn, 0, wxALL, 5);
-    }
-    else {
-        queueSizer->Add(new wxStaticText(contentPanel, wxID_ANY, "Queue kosong"), 0, wxALL, 5);
-    }
+    tenderProcessButton = new wxButton(contentPanel, 9002, "Proses Proyek Berikutnya");
+    tenderProcessButton->Bind(wxEVT_COMMAND_BUTTON_CLICKED, &MainFrame::OnProcessNextTenderProject, this);
+    queueSizer->Add(tenderProcessButton, 0, wxALL, 5);
 
     contentSizer->Add(queueSizer, 0, wxEXPAND | wxALL, 10);
 
@@ -1771,19 +1211,32 @@ void MainFrame::ShowTenderProjectManagementPage() {
     wxStaticBox* displayBox = new wxStaticBox(contentPanel, wxID_ANY, "Daftar Proyek Tender");
     wxStaticBoxSizer* displaySizer = new wxStaticBoxSizer(displayBox, wxVERTICAL);
 
-    tenderProjectsPanel = new wxScrolledWindow(contentPanel, wxID_ANY,
-        wxDefaultPosition, wxSize(-1, 300));
-    tenderProjectsPanel->SetScrollRate(5, 5);
-    tenderProjectsSizer = new wxBoxSizer(wxVERTICAL);
-    tenderProjectsPanel->SetSizer(tenderProjectsSizer);
+    tenderProjectsList = new TenderQueueListCtrl(contentPanel);
+    tenderProjectsList->Bind(wxEVT_LIST_ITEM_ACTIVATED, [this](wxListEvent& event) {
+        wxCommandEvent dummy;
+        this->OnUpdateTenderProjectStatus(dummy);
+        });
+
+    // Action Buttons (bekerja pada baris yang dipilih)
+    wxBoxSizer* buttonSizer = new wxBoxSizer(wxHORIZONTAL);
+
+    wxButton* editBtn = new wxButton(contentPanel, 9004, "Ubah Status/Prioritas");
+    editBtn->Bind(wxEVT_COMMAND_BUTTON_CLICKED, &MainFrame::OnUpdateTenderProjectStatus, this);
+    buttonSizer->Add(editBtn, 0, wxALL, 2);
+
+    wxButton* deleteBtn = new wxButton(contentPanel, 9003, "Hapus");
+    deleteBtn->Bind(wxEVT_COMMAND_BUTTON_CLICKED, &MainFrame::OnDeleteTenderProject, this);
+    buttonSizer->Add(deleteBtn, 0, wxALL, 2);
 
     RefreshTenderProjectsDisplay();
 
-    displaySizer->Add(tenderProjectsPanel, 1, wxEXPAND | wxALL, 5);
+    displaySizer->Add(tenderProjectsList, 1, wxEXPAND | wxALL, 5);
+    displaySizer->Add(buttonSizer, 0, wxALL, 5);
     contentSizer->Add(displaySizer, 1, wxEXPAND | wxALL, 10);
 }
 
 void MainFrame::OnSubmitTenderProject(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnSubmitTenderProject");
     // Validate inputs
     wxString name = tenderProjectNameInput->GetValue().Trim();
     if (name.IsEmpty()) {
@@ -1829,25 +1282,91 @@ void MainFrame::OnSubmitTenderProject(wxCommandEvent& event) {
         wxOK | wxICON_INFORMATION);
 
     // Refresh display
-    ShowMenuPage(9);
+    tenderProjectsList->AppendRow(queueTenderProjects.peekRear());
+    RefreshTenderQueueSummary();
 }
 
 void MainFrame::OnDeleteTenderProject(wxCommandEvent& event) {
-    wxButton* btn = static_cast<wxButton*>(event.GetEventObject());
-    wxString projectId = *static_cast<wxString*>(btn->GetClientData());
+    TRACE_SCOPE("MainFrame::OnDeleteTenderProject");
+    long row = tenderProjectsList->GetSelectedRow();
+    TenderProject* project = tenderProjectsList->GetProject(row);
+    if (!project) {
+        wxMessageBox("Pilih proyek tender terlebih dahulu.", "Error", wxOK | wxICON_ERROR);
+        return;
+    }
+    wxString projectId = GetTenderProjectId(project->key);
 
     int result = wxMessageBox("Apakah Anda yakin ingin menghapus proyek tender ini?",
         "Konfirmasi Hapus", wxYES_NO | wxICON_QUESTION);
 
     if (result == wxYES) {
+        // Hapus baris dulu supaya list tidak memegang pointer yang sudah di-free
+        tenderProjectsList->RemoveRow(row);
         DeleteTenderProject(projectId);
         wxMessageBox("Proyek tender berhasil dihapus!", "Sukses",
             wxOK | wxICON_INFORMATION);
-        ShowMenuPage(9); // Refresh page
+        RefreshTenderQueueSummary();
+    }
+}
+
+void MainFrame::OnUpdateTenderProjectStatus(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnUpdateTenderProjectStatus");
+    long row = tenderProjectsList->GetSelectedRow();
+    TenderProject* project = tenderProjectsList->GetProject(row);
+    if (!project) {
+        wxMessageBox("Pilih proyek tender terlebih dahulu.", "Error", wxOK | wxICON_ERROR);
+        return;
+    }
+
+    if (ShowEditTenderProjectDialog(project)) {
+        // Hanya baris ini yang berubah
+        tenderProjectsList->RefreshRow(row);
+    }
+}
+
+bool MainFrame::ShowEditTenderProjectDialog(TenderProject* project) {
+    wxDialog dlg(this, wxID_ANY, "Edit Proyek Tender: " + project->nama,
+        wxDefaultPosition, wxSize(350, 220));
+    wxBoxSizer* sizer = new wxBoxSizer(wxVERTICAL);
+
+    // Status
+    sizer->Add(new wxStaticText(&dlg, wxID_ANY, "Status:"), 0, wxALL, 5);
+    wxChoice* statusCtrl = new wxChoice(&dlg, wxID_ANY);
+    statusCtrl->Append("Pending");
+    statusCtrl->Append("In Review");
+    statusCtrl->Append("Approved");
+    statusCtrl->Append("Rejected");
+    int statusIndex = statusCtrl->FindString(project->status);
+    statusCtrl->SetSelection(statusIndex == wxNOT_FOUND ? 0 : statusIndex);
+    sizer->Add(statusCtrl, 0, wxEXPAND | wxALL, 5);
+
+    // Priority
+    sizer->Add(new wxStaticText(&dlg, wxID_ANY, "Prioritas:"), 0, wxALL, 5);
+    wxChoice* priorityCtrl = new wxChoice(&dlg, wxID_ANY);
+    priorityCtrl->Append("1 - Sangat Tinggi");
+    priorityCtrl->Append("2 - Tinggi");
+    priorityCtrl->Append("3 - Sedang");
+    priorityCtrl->Append("4 - Rendah");
+    priorityCtrl->Append("5 - Sangat Rendah");
+    priorityCtrl->SetSelection(project->priority - 1);
+    sizer->Add(priorityCtrl, 0, wxEXPAND | wxALL, 5);
+
+    sizer->Add(dlg.CreateButtonSizer(wxOK | wxCANCEL), 0, wxALL | wxALIGN_CENTER, 10);
+    dlg.SetSizer(sizer);
+    dlg.CenterOnParent();
+
+    if (dlg.ShowModal() != wxID_OK) {
+        return false;
     }
+
+    RegistryWriteLock lock(DATA_TENDER);
+    project->status = statusCtrl->GetString(statusCtrl->GetSelection());
+    project->priority = priorityCtrl->GetSelection() + 1;
+    return true;
 }
 
 void MainFrame::OnProcessNextTenderProject(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnProcessNextTenderProject");
     TenderProject* nextProject = GetNextTenderProject();
     if (!nextProject) {
         wxMessageBox("Queue kosong!", "Info", wxOK | wxICON_INFORMATION);
@@ -1856,96 +1375,52 @@ void MainFrame::OnProcessNextTenderProject(wxCommandEvent& event) {
 
     wxString message = wxString::Format(
         "Memproses proyek: %s\nID: %s\nKlien: %s\n\nProyek akan dihapus dari queue. Lanjutkan?",
-        nextProject->nama, nextProject->id, nextProject->clientName
+        nextProject->nama.ToWxString(), GetTenderProjectId(nextProject->key), nextProject->clientName.ToWxString()
     );
 
     int result = wxMessageBox(message, "Proses Proyek Berikutnya",
         wxYES_NO | wxICON_QUESTION);
 
     if (result == wxYES) {
+        tenderProjectsList->RemoveRow(0);
         ProcessNextTenderProject();
         wxMessageBox("Proyek berhasil diproses dan dihapus dari queue!", "Sukses",
             wxOK | wxICON_INFORMATION);
-        ShowMenuPage(9); // Refresh page
+        RefreshTenderQueueSummary();
     }
 }
 
 void MainFrame::RefreshTenderProjectsDisplay() {
-    tenderProjectsSizer->Clear(true);
+    PERF_SCOPE("RefreshTenderProjectsDisplay");
+    tenderProjectsList->Reload();
+    RefreshTenderQueueSummary();
+}
 
-    std::vector<TenderProject> projects = GetTenderProjectsVector();
+void MainFrame::RefreshTenderQueueSummary() {
+    tenderQueueCountLabel->SetLabel(wxString::Format("Total Proyek dalam Queue: %zu",
+        queueTenderProjects.size()));
 
-    if (projects.empty()) {
-        wxStaticText* emptyMsg = new wxStaticText(tenderProjectsPanel, wxID_ANY,
-            "Belum ada proyek tender dalam queue.");
-        tenderProjectsSizer->Add(emptyMsg, 0, wxALL, 10);
+    TenderProject* nextProject = GetNextTenderProject();
+    if (nextProject) {
+        tenderNextProjectLabel->SetLabel(wxString::Format("Proyek Berikutnya: %s (%s)",
+            nextProject->nama.ToWxString(), GetTenderProjectId(nextProject->key)));
     }
     else {
-        int position = 1;
-        for (const auto& project : projects) {
-            wxPanel* projectPanel = new wxPanel(tenderProjectsPanel);
-            wxBoxSizer* projectSizer = new wxBoxSizer(wxVERTICAL);
-
-            // Project Header
-            wxString headerText = wxString::Format("#%d - %s (%s)",
-                position++, project.nama, project.id);
-            wxStaticText* header = new wxStaticText(projectPanel, wxID_ANY, headerText);
-            wxFont headerFont = header->GetFont();
-            headerFont.SetWeight(wxFONTWEIGHT_BOLD);
-            header->SetFont(headerFont);
-            projectSizer->Add(header, 0, wxALL, 5);
-
-            // Project Details
-            wxString details = wxString::Format(
-                "Kategori: %s | Status: %s | Prioritas: %d\n"
-                "Klien: %s | Estimasi: Rp %s\n"
-                "Tanggal Tender: %s",
-                project.kategori, project.status, project.priority,
-                project.clientName.IsEmpty() ? "Tidak disebutkan" : project.clientName,
-                project.estimatedValue > 0 ? wxString::Format("%d", project.estimatedValue) : "Tidak disebutkan",
-                project.tenderDate.IsEmpty() ? "Tidak disebutkan" : project.tenderDate
-            );
-
-            wxStaticText* detailsText = new wxStaticText(projectPanel, wxID_ANY, details);
-            projectSizer->Add(detailsText, 0, wxALL | wxEXPAND, 5);
-
-            if (!project.description.IsEmpty()) {
-                wxString descText = "Deskripsi: " + project.description;
-                wxStaticText* desc = new wxStaticText(projectPanel, wxID_ANY, descText);
-                projectSizer->Add(desc, 0, wxALL | wxEXPAND, 5);
-            }
-
-            // Action Buttons
-            wxBoxSizer* buttonSizer = new wxBoxSizer(wxHORIZONTAL);
-
-            wxButton* deleteBtn = new wxButton(projectPanel, 9003, "Hapus");
-            deleteBtn->SetClientData(new wxString(project.id));
-            deleteBtn->Bind(wxEVT_COMMAND_BUTTON_CLICKED, &MainFrame::OnDeleteTenderProject, this);
-            buttonSizer->Add(deleteBtn, 0, wxALL, 2);
-
-            projectSizer->Add(buttonSizer, 0, wxALL, 5);
-
-            projectPanel->SetSizer(projectSizer);
-            tenderProjectsSizer->Add(projectPanel, 0, wxEXPAND | wxALL, 5);
-
-            // Add separator
-            wxStaticLine* separator = new wxStaticLine(tenderProjectsPanel);
-            tenderProjectsSizer->Add(separator, 0, wxEXPAND | wxALL, 2);
-        }
+        tenderNextProjectLabel->SetLabel("Queue kosong");
     }
-
-    tenderProjectsPanel->Layout();
-    tenderProjectsPanel->FitInside();
+    tenderProcessButton->Enable(nextProject != nullptr);
 }
 
 
 void MainFrame::OnDeleteConnection(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnDeleteConnection");
     wxButton* btn = dynamic_cast<wxButton*>(event.GetEventObject());
     if (btn) {
-        AssetConnection* conn = static_cast<AssetConnection*>(btn->GetClientData());
-        if (conn) {
-            wxString fromName = GetAssetNameById(conn->fromAssetId);
-            wxString toName = GetAssetNameById(conn->toAssetId);
+        ConnectionClientData* data = static_cast<ConnectionClientData*>(btn->GetClientObject());
+        if (data) {
+            const AssetConnection* conn = &data->connection;
+            wxString fromName = GetAssetNameByKey(conn->fromAssetKey);
+            wxString toName = GetAssetNameByKey(conn->toAssetKey);
 
             int result = wxMessageBox(
                 wxString::Format("Apakah Anda yakin ingin menghapus koneksi antara '%s' dan '%s'?",
@@ -1953,27 +1428,24 @@ void MainFrame::OnDeleteConnection(wxCommandEvent& event) {
                 "Konfirmasi Hapus", wxYES_NO | wxICON_QUESTION);
 
             if (result == wxYES) {
-                DeleteAssetConnection(conn->fromAssetId, conn->toAssetId);
+                DeleteAssetConnection(GetAssetId(conn->fromAssetKey), GetAssetId(conn->toAssetKey));
                 wxMessageBox("Koneksi berhasil dihapus.", "Sukses", wxOK | wxICON_INFORMATION);
                 ShowMenuPage(7); // Refresh the page
             }
-            delete conn;
         }
     }
 }
 
 void MainFrame::OnViewAssetConnections(wxCommandEvent& event) {
-    int selection = selectedAssetDropdown->GetSelection();
-    if (selection == wxNOT_FOUND) {
+    TRACE_SCOPE("MainFrame::OnViewAssetConnections");
+    wxString assetId = selectedAssetPicker->GetSelectedAssetId();
+    if (assetId.IsEmpty()) {
         wxMessageBox("Pilih aset terlebih dahulu.", "Error", wxOK | wxICON_ERROR);
         return;
     }
-
-    wxString selectedText = selectedAssetDropdown->GetString(selection);
-    wxString assetId = selectedText.BeforeFirst(' ');
     wxString assetName = GetAssetNameById(assetId);
 
-    std::vector<AssetConnection> connections = GetConnectionsForAsset(assetId);
+    FilteredListView<AssetConnection, ConnectionTouches> connections = GetConnectionsForAsset(assetId);
 
     wxString message;
     if (connections.empty()) {
@@ -1981,9 +1453,11 @@ void MainFrame::OnViewAssetConnections(wxCommandEvent& event) {
     }
     else {
         message = wxString::Format("Koneksi untuk aset '%s':\n\n", assetName);
+        EntityKey assetKey = NO_ENTITY_KEY;
+        assetKeys.Find(assetId, assetKey);
         for (const auto& conn : connections) {
-            wxString otherAssetId = (conn.fromAssetId == assetId) ? conn.toAssetId : conn.fromAssetId;
-            wxString otherAssetName = GetAssetNameById(otherAssetId);
+            EntityKey otherAssetKey = (conn.fromAssetKey == assetKey) ? conn.toAssetKey : conn.fromAssetKey;
+            wxString otherAssetName = GetAssetNameByKey(otherAssetKey);
 
             message += wxString::Format("• %s (Bobot: %d)", otherAssetName, conn.weight);
             if (!conn.description.IsEmpty()) {
@@ -1996,35 +1470,129 @@ void MainFrame::OnViewAssetConnections(wxCommandEvent& event) {
     wxMessageBox(message, "Koneksi Aset: " + assetName, wxOK | wxICON_INFORMATION);
 }
 
+void MainFrame::OnCheckAssetCluster(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnCheckAssetCluster");
+    wxString fromId = fromAssetPicker->GetSelectedAssetId();
+    wxString toId = toAssetPicker->GetSelectedAssetId();
+
+    if (fromId.IsEmpty() || toId.IsEmpty()) {
+        wxMessageBox("Pilih aset asal dan tujuan.", "Error", wxOK | wxICON_ERROR);
+        return;
+    }
+
+    wxString fromName = GetAssetNameById(fromId);
+    wxString toName = GetAssetNameById(toId);
+    wxString message;
+    if (AssetsInSameCluster(fromId, toId)) {
+        EntityKey fromKey = NO_ENTITY_KEY;
+        assetKeys.Find(fromId, fromKey);
+        message = wxString::Format("'%s' dan '%s' berada di cluster yang sama (%u aset).",
+            fromName, toName, assetClusters.GetClusterSize(fromKey));
+    }
+    else {
+        message = wxString::Format("'%s' dan '%s' tidak terhubung, langsung maupun lewat aset lain.",
+            fromName, toName);
+    }
+    wxMessageBox(message, "Cluster Aset", wxOK | wxICON_INFORMATION);
+}
+
+void MainFrame::OnComputeSpanningForest(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnComputeSpanningForest");
+    if (spanningTask.IsRunning()) {
+        wxMessageBox("Jaringan minimum masih dihitung.", "Info", wxOK | wxICON_INFORMATION);
+        return;
+    }
+
+    spanningTask = workerPool->Submit<std::shared_ptr<SpanningForest>>(this,
+        [](TaskContext& context) {
+            RegistryReadLock lock;
+            return std::make_shared<SpanningForest>(ComputeMinimumSpanningForest(&context));
+        },
+        [this](std::shared_ptr<SpanningForest>& forest) {
+            ClearTaskProgress();
+            if (forest->cancelled) return;
+            spanningForest = forest;
+
+            // Daftar koneksi dibangun ulang supaya koneksi terpilih ditandai
+            pageCache[7].built = false;
+            if (currentMenuPage == 7) ShowMenuPage(7);
+        },
+        [this](int percent) { ShowTaskProgress("Menghitung jaringan minimum", percent); });
+}
+
 void MainFrame::RefreshAssetDropdowns() {
     // This method can be called when assets are added/removed
-    // to refresh all dropdown choices in the graph management page
-    if (fromAssetDropdown && toAssetDropdown && selectedAssetDropdown) {
-        std::vector<Aset> assets = GetAssetsVector();
-
-        fromAssetDropdown->Clear();
-        toAssetDropdown->Clear();
-        selectedAssetDropdown->Clear();
-
-        for (const auto& asset : assets) {
-            wxString displayText = asset.id + " - " + asset.nama;
-            fromAssetDropdown->Append(displayText);
-            toAssetDropdown->Append(displayText);
-            selectedAssetDropdown->Append(displayText);
-        }
+    // to refresh all asset pickers in the graph management page
+    if (fromAssetPicker && toAssetPicker && selectedAssetPicker) {
+        GetAssetIndex();
+
+        fromAssetPicker->Reset();
+        toAssetPicker->Reset();
+        selectedAssetPicker->Reset();
+
+        fromAssetPicker->SelectMatch(0);
+        toAssetPicker->SelectMatch(1);
+        selectedAssetPicker->SelectMatch(0);
+    }
+}
 
-        if (!assets.empty()) {
-            fromAssetDropdown->SetSelection(0);
-            toAssetDropdown->SetSelection(assets.size() > 1 ? 1 : 0);
-            selectedAssetDropdown->SetSelection(0);
+const AssetPrefixIndex* MainFrame::GetAssetIndex() {
+    unsigned long stamp = GetDataStamp(DATA_ASET);
+    if (stamp != assetIndexStamp) {
+        assetIndex.Clear();
+        for (const auto& aset : daftarAset) {
+            assetIndex.Add(GetAssetId(aset.key), aset.nama);
         }
+        assetIndex.Finalize();
+        assetIndexStamp = stamp;
     }
+    return &assetIndex;
 }
 
 
 
 void MainFrame::ShowMenuPage(int menuNumber) {
+    int pageIndex = (menuNumber >= 1 && menuNumber <= 11) ? menuNumber : 0;
+    PageCacheEntry& page = pageCache[pageIndex];
+
+    // Satu timer per halaman, termasuk rebuild jika datanya berubah
+    static std::vector<PerfMetric> pageMetrics;
+    if (pageMetrics.empty()) {
+        for (size_t i = 0; i < pageCache.size(); i++) {
+            pageMetrics.push_back(PerfMetric(
+                wxString::Format("ShowMenuPage/%02zu", i).ToStdString(), PERF_TIMER));
+        }
+    }
+    PERF_SCOPE_METRIC(pageMetrics[pageIndex]);
+
+    currentMenuPage = menuNumber;
+    contentPanel = page.panel;
+    contentSizer = page.sizer;
+
+    // Halaman lama tetap dipakai selama data yang ditampilkannya belum berubah
+    if (!page.built || pageIndex == 0 || GetDataStamp(page.dependencies) != page.builtStamp) {
+        RebuildPage(pageIndex, menuNumber);
+        page.built = true;
+        page.builtStamp = GetDataStamp(page.dependencies);
+    }
+    else if (pageIndex == 11) {
+        RefreshPerformanceList();
+    }
+
+    pageBook->ChangeSelection(pageIndex);
+}
+
+void MainFrame::RebuildPage(int pageIndex, int menuNumber) {
+    TRACE_SCOPE("MainFrame::RebuildPage");
+    // Task yang masih menulis ke widget halaman ini dihentikan dulu
+    pageTasks[pageIndex].Cancel();
+    if (pageIndex == 8) {
+        treeDisplaySizer = nullptr;
+        billingMonthDropdown = nullptr;
+    }
+
     contentSizer->Clear(true);
+    contentPanel->DestroyChildren();
 
     if (menuNumber == 1) {
         ShowCategoryManagementPage();
@@ -2056,6 +1624,9 @@ void MainFrame::ShowMenuPage(int menuNumber) {
     else if (menuNumber == 10) {
         ShowRecentAssetsPage();
     }
+    else if (menuNumber == 11) {
+        ShowPerformancePage();
+    }
     else {
         wxString labelText = wxString::Format("Menu %d - Coming Soon", menuNumber);
         wxStaticText* label = new wxStaticText(contentPanel, wxID_ANY, labelText);
@@ -2114,7 +1685,7 @@ void MainFrame::ShowRecentAssetsPage() {
 void MainFrame::RefreshRecentAssetsDisplay() {
     recentAssetsSizer->Clear(true);
 
-    std::vector<AssetHistory> history = GetAssetHistoryVector();
+    ListView<AssetHistory> history = GetAssetHistory();
 
     if (history.empty()) {
         wxStaticText* emptyText = new wxStaticText(recentAssetsPanel, wxID_ANY,
@@ -2123,8 +1694,9 @@ void MainFrame::RefreshRecentAssetsDisplay() {
         recentAssetsSizer->Add(emptyText, 0, wxALL | wxALIGN_CENTER_HORIZONTAL, 20);
     }
     else {
-        for (size_t i = 0; i < history.size(); i++) {
-            const AssetHistory& item = history[i];
+        size_t i = 0;
+        for (auto it = history.begin(); it != history.end(); ++it, ++i) {
+            const AssetHistory& item = *it;
 
             // Panel untuk setiap item
             wxPanel* itemPanel = new wxPanel(recentAssetsPanel, wxID_ANY);
@@ -2133,7 +1705,7 @@ void MainFrame::RefreshRecentAssetsDisplay() {
 
             // Header: Ranking + Asset Name
             wxString headerText = wxString::Format("#%zu - %s (%s)",
-                i + 1, item.assetName, item.assetId);
+                i + 1, item.assetName.ToWxString(), item.assetId.ToWxString());
             wxStaticText* header = new wxStaticText(itemPanel, wxID_ANY, headerText);
             wxFont headerFont = header->GetFont();
             headerFont.SetWeight(wxFONTWEIGHT_BOLD);
@@ -2141,13 +1713,13 @@ void MainFrame::RefreshRecentAssetsDisplay() {
 
             // Details
             wxString detailText = wxString::Format("Tipe: %s | Diakses: %s",
-                item.assetType, item.accessTime);
+                item.assetType.ToWxString(), item.accessTime.ToWxString());
             wxStaticText* details = new wxStaticText(itemPanel, wxID_ANY, detailText);
             details->SetForegroundColour(wxColour(64, 64, 64));
 
             // Open Button
             wxButton* openBtn = new wxButton(itemPanel, 10002, "Buka Detail");
-            openBtn->SetClientData(new wxString(item.assetId)); // Store asset ID
+            openBtn->SetClientObject(new wxStringClientData(item.assetId)); // Store asset ID
             openBtn->Bind(wxEVT_COMMAND_BUTTON_CLICKED, &MainFrame::OnOpenRecentAsset, this);
 
             itemSizer->Add(header, 0, wxALL, 5);
@@ -2169,11 +1741,15 @@ void MainFrame::RefreshRecentAssetsDisplay() {
 }
 
 void MainFrame::OnClearHistory(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnClearHistory");
     int result = wxMessageBox("Apakah Anda yakin ingin menghapus semua history akses aset?",
         "Konfirmasi", wxYES_NO | wxICON_QUESTION);
     if (result == wxYES) {
-        while (!assetHistoryStack.empty()) {
-            assetHistoryStack.pop();
+        {
+            RegistryWriteLock lock(DATA_HISTORY);
+            while (!assetHistoryStack.empty()) {
+                assetHistoryStack.pop();
+            }
         }
         wxMessageBox("History berhasil dihapus!", "Sukses", wxOK | wxICON_INFORMATION);
         ShowMenuPage(10); // Refresh page
@@ -2181,13 +1757,14 @@ void MainFrame::OnClearHistory(wxCommandEvent& event) {
 }
 
 void MainFrame::OnOpenRecentAsset(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnOpenRecentAsset");
     wxButton* btn = dynamic_cast<wxButton*>(event.GetEventObject());
-    if (btn && btn->GetClientData()) {
-        wxString* assetId = static_cast<wxString*>(btn->GetClientData());
+    if (btn && btn->GetClientObject()) {
+        wxString assetId = static_cast<wxStringClientData*>(btn->GetClientObject())->GetData();
 
         // Implementasi buka detail aset (sesuaikan dengan sistem Anda)
         // Contoh: redirect ke asset detail page atau search page
-        wxMessageBox(wxString::Format("Membuka detail aset: %s", *assetId),
+        wxMessageBox(wxString::Format("Membuka detail aset: %s", assetId),
             "Info", wxOK | wxICON_INFORMATION);
 
         // Anda bisa redirect ke halaman yang sesuai, misalnya:
@@ -2227,12 +1804,16 @@ void MainFrame::ShowCategoryManagementPage() {
         wxBoxSizer* rowSizer = new wxBoxSizer(wxHORIZONTAL);
 
         wxStaticText* label = new wxStaticText(contentPanel, wxID_ANY, categories[i]);
+        wxButton* renameBtn = new wxButton(contentPanel, wxID_ANY, "Ubah Nama");
         wxButton* deleteBtn = new wxButton(contentPanel, 2000 + static_cast<int>(i), "Hapus");
 
-        deleteBtn->SetClientData(new wxString(categories[i]));
+        renameBtn->SetClientObject(new wxStringClientData(categories[i]));
+        renameBtn->Bind(wxEVT_BUTTON, &MainFrame::OnRenameCategory, this);
+        deleteBtn->SetClientObject(new wxStringClientData(categories[i]));
         deleteBtn->Bind(wxEVT_BUTTON, &MainFrame::OnDeleteCategory, this);
 
         rowSizer->Add(label, 1, wxALIGN_CENTER_VERTICAL | wxRIGHT, 10);
+        rowSizer->Add(renameBtn, 0, wxRIGHT, 5);
         rowSizer->Add(deleteBtn, 0);
 
         contentSizer->Add(rowSizer, 0, wxEXPAND | wxALL, 5);
@@ -2297,18 +1878,20 @@ void MainFrame::ShowAssetListPage() {
     assetGrid->SetColSize(2, 150);
     assetGrid->SetColSize(3, 100);
 
-    std::vector<Aset> assets = GetAssetsVector();
+    ListView<Aset> assets = GetAssets();
+    assetGrid->AppendRows(static_cast<int>(assets.size()));
 
-    for (size_t i = 0; i < assets.size(); ++i) {
-        assetGrid->AppendRows(1);
-        assetGrid->SetCellValue(i, 0, assets[i].id);
-        assetGrid->SetCellValue(i, 1, assets[i].nama);
-        assetGrid->SetCellValue(i, 2, assets[i].kategori);
+    int i = 0;
+    for (const auto& aset : assets) {
+        assetGrid->SetCellValue(i, 0, GetAssetId(aset.key));
+        assetGrid->SetCellValue(i, 1, aset.nama);
+        assetGrid->SetCellValue(i, 2, GetCategoryName(aset.kategori));
         assetGrid->SetCellValue(i, 3, "Hapus");
 
         assetGrid->SetReadOnly(i, 0);
         assetGrid->SetReadOnly(i, 1);
         assetGrid->SetReadOnly(i, 2);
+        i++;
     }
 
     assetGrid->Bind(wxEVT_GRID_CELL_LEFT_CLICK, &MainFrame::OnAssetGridClick, this);
@@ -2353,70 +1936,184 @@ void MainFrame::ShowStatisticsPage() {
 
     contentSizer->Add(title, 0, wxALIGN_CENTER | wxTOP | wxBOTTOM, 15);
 
-    // Count assets by category
-    LinkedList<CategoryCount> categoryCounts;
-    initializeCategoryCounts(daftarKategori, categoryCounts);
-    countAssetsByCategory(daftarAset, categoryCounts);
-
-    // Display statistics
-    wxStaticText* categoryStatsLabel = new wxStaticText(contentPanel, wxID_ANY, "Jumlah Aset per Kategori:");
-    wxFont labelFont = categoryStatsLabel->GetFont();
-    labelFont.SetWeight(wxFONTWEIGHT_BOLD);
-    categoryStatsLabel->SetFont(labelFont);
-    contentSizer->Add(categoryStatsLabel, 0, wxTOP | wxBOTTOM, 10);
+    wxStaticText* loadingLabel = new wxStaticText(contentPanel, wxID_ANY, "Menghitung statistik...");
+    contentSizer->Add(loadingLabel, 0, wxALL, 5);
+
+    // Agregasi berjalan di worker, label dibuat setelah hasil kembali
+    wxPanel* page = contentPanel;
+    wxBoxSizer* pageSizer = contentSizer;
+    pageTasks[5] = workerPool->Submit<StatisticsPageData>(this,
+        [](TaskContext& context) {
+            RegistryReadLock lock;
+            StatisticsPageData data;
+            data.statistics = ComputeStatistics(&context);
+            if (!context.IsCancelled()) {
+                data.memory = ComputeMemoryReport(&context);
+            }
+            return data;
+        },
+        [this, page, pageSizer, loadingLabel](StatisticsPageData& data) {
+            const StatisticsSnapshot& snapshot = data.statistics;
+            ClearTaskProgress();
+            loadingLabel->Destroy();
+
+            // Display statistics
+            wxStaticText* categoryStatsLabel = new wxStaticText(page, wxID_ANY, "Jumlah Aset per Kategori:");
+            wxFont labelFont = categoryStatsLabel->GetFont();
+            labelFont.SetWeight(wxFONTWEIGHT_BOLD);
+            categoryStatsLabel->SetFont(labelFont);
+            pageSizer->Add(categoryStatsLabel, 0, wxTOP | wxBOTTOM, 10);
+
+            for (const auto& categoryCount : snapshot.categoryCounts) {
+                wxString statText = wxString::Format("%s: %d aset",
+                    categoryCount.kategori, categoryCount.count);
+                wxStaticText* stat = new wxStaticText(page, wxID_ANY, statText);
+                pageSizer->Add(stat, 0, wxALL, 5);
+            }
 
-    Node<CategoryCount>* current = categoryCounts.getHead();
-    while (current) {
-        wxString statText = wxString::Format("%s: %d aset",
-            current->data.kategori, current->data.count);
-        wxStaticText* stat = new wxStaticText(contentPanel, wxID_ANY, statText);
-        contentSizer->Add(stat, 0, wxALL, 5);
-        current = current->next;
-    }
+            // Total assets
+            wxString totalText = wxString::Format("Total Aset: %zu", snapshot.totalAssets);
+            wxStaticText* totalStat = new wxStaticText(page, wxID_ANY, totalText);
+            wxFont totalFont = totalStat->GetFont();
+            totalFont.SetWeight(wxFONTWEIGHT_BOLD);
+            totalStat->SetFont(totalFont);
+            pageSizer->Add(totalStat, 0, wxTOP | wxBOTTOM, 15);
+
+            // Asset value statistics
+            if (snapshot.hasValueDetails) {
+                wxStaticText* valueStatsLabel = new wxStaticText(page, wxID_ANY, "Statistik Nilai Aset:");
+                valueStatsLabel->SetFont(labelFont);
+                pageSizer->Add(valueStatsLabel, 0, wxTOP | wxBOTTOM, 10);
+
+                wxString valueText = wxString::Format("Total Nilai Aset: Rp %lld", snapshot.totalValue);
+                wxString maintenanceText = wxString::Format("Total Biaya Maintenance: Rp %lld", snapshot.totalMaintenance);
+                wxString taxText = wxString::Format("Total Pajak Properti: Rp %lld", snapshot.totalTax);
+
+                pageSizer->Add(new wxStaticText(page, wxID_ANY, valueText), 0, wxALL, 5);
+                pageSizer->Add(new wxStaticText(page, wxID_ANY, maintenanceText), 0, wxALL, 5);
+                pageSizer->Add(new wxStaticText(page, wxID_ANY, taxText), 0, wxALL, 5);
+            }
 
-    // Total assets
-    size_t totalAssets = daftarAset.size();
-    wxString totalText = wxString::Format("Total Aset: %zu", totalAssets);
-    wxStaticText* totalStat = new wxStaticText(contentPanel, wxID_ANY, totalText);
-    wxFont totalFont = totalStat->GetFont();
-    totalFont.SetWeight(wxFONTWEIGHT_BOLD);
-    totalStat->SetFont(totalFont);
-    contentSizer->Add(totalStat, 0, wxTOP | wxBOTTOM, 15);
-
-    // Asset value statistics
-    if (!daftarDetailNilaiAset.empty()) {
-        wxStaticText* valueStatsLabel = new wxStaticText(contentPanel, wxID_ANY, "Statistik Nilai Aset:");
-        valueStatsLabel->SetFont(labelFont);
-        contentSizer->Add(valueStatsLabel, 0, wxTOP | wxBOTTOM, 10);
-
-        int totalValue = 0;
-        int totalMaintenance = 0;
-        int totalTax = 0;
-        Node<AssetValueDetails>* valueNode = daftarDetailNilaiAset.getHead();
-        while (valueNode) {
-            totalValue += valueNode->data.currentValue;
-            totalMaintenance += valueNode->data.maintenanceCost;
-            totalTax += valueNode->data.propertyTax;
-            valueNode = valueNode->next;
-        }
+            // Okupansi sewa sub-aset (dari rollup tree)
+            if (snapshot.totalSubAssets > 0) {
+                wxStaticText* rentalStatsLabel = new wxStaticText(page, wxID_ANY, "Statistik Sewa Sub-Aset:");
+                rentalStatsLabel->SetFont(labelFont);
+                pageSizer->Add(rentalStatsLabel, 0, wxTOP | wxBOTTOM, 10);
+
+                wxString occupancyText = wxString::Format("Unit Disewa: %zu dari %zu (%.1f%%)",
+                    snapshot.rentedSubAssets, snapshot.totalSubAssets,
+                    100.0 * snapshot.rentedSubAssets / snapshot.totalSubAssets);
+                wxString incomeText = wxString::Format("Total Pendapatan Sewa: Rp %lld", snapshot.totalRentalIncome);
+
+                pageSizer->Add(new wxStaticText(page, wxID_ANY, occupancyText), 0, wxALL, 5);
+                pageSizer->Add(new wxStaticText(page, wxID_ANY, incomeText), 0, wxALL, 5);
+
+                // Okupansi bulanan dari ledger sewa
+                wxListCtrl* occupancyList = new wxListCtrl(page, wxID_ANY, wxDefaultPosition, wxSize(-1, 200),
+                    wxLC_REPORT | wxLC_HRULES | wxLC_VRULES);
+                occupancyList->InsertColumn(0, "Bulan", wxLIST_FORMAT_LEFT, 90);
+                occupancyList->InsertColumn(1, "Unit Tersewa", wxLIST_FORMAT_RIGHT, 100);
+                occupancyList->InsertColumn(2, "Okupansi", wxLIST_FORMAT_RIGHT, 80);
+                for (size_t i = 0; i < snapshot.monthlyOccupancy.size(); i++) {
+                    const MonthlyOccupancy& occupancy = snapshot.monthlyOccupancy[i];
+                    long row = occupancyList->InsertItem(static_cast<long>(i),
+                        wxString::Format("%02d/%04d", occupancy.month, occupancy.year));
+                    occupancyList->SetItem(row, 1, wxString::Format("%zu / %zu", occupancy.leasedUnits, occupancy.units));
+                    occupancyList->SetItem(row, 2, wxString::Format("%.1f%%", 100.0 * occupancy.occupancyRate));
+                }
+                pageSizer->Add(occupancyList, 0, wxEXPAND | wxALL, 5);
+            }
 
-        wxString valueText = wxString::Format("Total Nilai Aset: Rp %d", totalValue);
-        wxString maintenanceText = wxString::Format("Total Biaya Maintenance: Rp %d", totalMaintenance);
-        wxString taxText = wxString::Format("Total Pajak Properti: Rp %d", totalTax);
+            // Memori per struktur registry
+            wxStaticText* memoryLabel = new wxStaticText(page, wxID_ANY,
+                wxString::Format("Memori per Struktur (total %s):", FormatBytes(data.memory.totalBytes)));
+            memoryLabel->SetFont(labelFont);
+            pageSizer->Add(memoryLabel, 0, wxTOP | wxBOTTOM, 10);
+
+            wxListCtrl* memoryList = new wxListCtrl(page, wxID_ANY, wxDefaultPosition, wxSize(-1, 230),
+                wxLC_REPORT | wxLC_HRULES | wxLC_VRULES);
+            memoryList->InsertColumn(0, "Struktur", wxLIST_FORMAT_LEFT, 120);
+            memoryList->InsertColumn(1, "Node", wxLIST_FORMAT_RIGHT, 70);
+            memoryList->InsertColumn(2, "Payload", wxLIST_FORMAT_RIGHT, 80);
+            memoryList->InsertColumn(3, "Overhead", wxLIST_FORMAT_RIGHT, 80);
+            memoryList->InsertColumn(4, "String", wxLIST_FORMAT_RIGHT, 80);
+            memoryList->InsertColumn(5, "Total", wxLIST_FORMAT_RIGHT, 80);
+            for (size_t i = 0; i < data.memory.structures.size(); i++) {
+                const StructureMemory& memory = data.memory.structures[i];
+                long row = memoryList->InsertItem(static_cast<long>(i), memory.name);
+                memoryList->SetItem(row, 1, wxString::Format("%zu", memory.nodes));
+                memoryList->SetItem(row, 2, FormatBytes(memory.payloadBytes));
+                memoryList->SetItem(row, 3, FormatBytes(memory.overheadBytes));
+                memoryList->SetItem(row, 4, FormatBytes(memory.stringBytes));
+                memoryList->SetItem(row, 5, FormatBytes(memory.TotalBytes()));
+            }
+            pageSizer->Add(memoryList, 0, wxEXPAND | wxALL, 5);
 
-        contentSizer->Add(new wxStaticText(contentPanel, wxID_ANY, valueText), 0, wxALL, 5);
-        contentSizer->Add(new wxStaticText(contentPanel, wxID_ANY, maintenanceText), 0, wxALL, 5);
-        contentSizer->Add(new wxStaticText(contentPanel, wxID_ANY, taxText), 0, wxALL, 5);
-    }
+            page->Layout();
+        },
+        [this](int percent) { ShowTaskProgress("Menghitung statistik", percent); });
 }
 
 void MainFrame::OnButtonClicked(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnButtonClicked");
     int id = event.GetId();
     int menuNumber = id - 1000;
     ShowMenuPage(menuNumber);
 }
 
+void MainFrame::OnGeneratePortfolio(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnGeneratePortfolio");
+    int confirm = wxMessageBox("Semua data saat ini akan diganti dengan data uji sintetis.\n"
+        "Lanjutkan?", "Generate Data Uji", wxYES_NO | wxICON_WARNING);
+    if (confirm != wxYES) return;
+
+    long assetCount = wxGetNumberFromUser("Jumlah aset yang dibuat (sub-aset, koneksi\n"
+        "dan tender mengikuti jumlah aset).", "Jumlah aset:", "Generate Data Uji",
+        10000, 1, 1000000, this);
+    if (assetCount <= 0) return;
+
+    long seed = wxGetNumberFromUser("Seed yang sama menghasilkan data yang sama persis.",
+        "Seed:", "Generate Data Uji", 42, 0, 1000000, this);
+    if (seed < 0) return;
+
+    // Data dibuat di worker tanpa menyentuh registry, lalu ditukar di UI thread
+    PortfolioSpec spec = DefaultPortfolioSpec(static_cast<size_t>(assetCount), static_cast<unsigned>(seed));
+    workerPool->Submit<std::shared_ptr<Portfolio>>(this,
+        [spec](TaskContext& context) {
+            std::shared_ptr<Portfolio> portfolio = std::make_shared<Portfolio>();
+            if (!GeneratePortfolio(spec, *portfolio, &context)) portfolio->Clear();
+            return portfolio;
+        },
+        [this, spec](std::shared_ptr<Portfolio>& portfolio) {
+            ClearTaskProgress();
+
+            // Task halaman lama memegang read lock, hentikan dulu sebelum swap
+            for (TaskHandle& task : pageTasks) {
+                task.Cancel();
+            }
+            billingTask.Cancel();
+            spanningTask.Cancel();
+            LoadPortfolio(*portfolio);
+
+            // Portfolio sekarang berisi data lama; hapus di worker supaya UI tidak macet
+            std::shared_ptr<Portfolio> oldData = portfolio;
+            workerPool->Submit<bool>(this,
+                [oldData](TaskContext&) {
+                    oldData->Clear();
+                    return true;
+                },
+                nullptr);
+
+            // Semua data stamp berubah, halaman dibangun ulang saat dibuka
+            ShowMenuPage(currentMenuPage);
+            wxMessageBox(wxString::Format("Data uji berhasil dibuat: %zu aset.", spec.assetCount),
+                "Sukses", wxOK | wxICON_INFORMATION);
+        },
+        [this](int percent) { ShowTaskProgress("Membuat data uji", percent); });
+}
+
 void MainFrame::OnSubmitCategory(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnSubmitCategory");
     wxString categoryName = categoryNameInput->GetValue().Trim();
 
     if (categoryName.IsEmpty()) {
@@ -2437,26 +2134,72 @@ void MainFrame::OnSubmitCategory(wxCommandEvent& event) {
     ShowMenuPage(1);
 }
 
+// Aset hanya menyimpan ID kategori, jadi rename tidak menyentuh aset sama sekali
+void MainFrame::OnRenameCategory(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnRenameCategory");
+    wxButton* btn = dynamic_cast<wxButton*>(event.GetEventObject());
+    if (!btn) return;
+    wxStringClientData* data = static_cast<wxStringClientData*>(btn->GetClientObject());
+    if (!data) return;
+
+    wxString oldName = data->GetData();
+    wxString newName = wxGetTextFromUser("Nama baru untuk kategori '" + oldName + "':",
+        "Ubah Nama Kategori", oldName, this).Trim();
+    if (newName.IsEmpty() || newName == oldName) return;
+
+    if (!RenameCategory(oldName, newName)) {
+        wxMessageBox("Kategori dengan nama itu sudah ada.", "Error", wxOK | wxICON_ERROR);
+        return;
+    }
+    wxMessageBox("Nama kategori berhasil diubah.", "Sukses", wxOK | wxICON_INFORMATION);
+
+    // Refresh the page
+    ShowMenuPage(1);
+}
+
 void MainFrame::OnDeleteCategory(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnDeleteCategory");
     wxButton* btn = dynamic_cast<wxButton*>(event.GetEventObject());
     if (btn) {
-        wxString* categoryName = static_cast<wxString*>(btn->GetClientData());
-        if (categoryName) {
-            int result = wxMessageBox("Apakah Anda yakin ingin menghapus kategori '" + *categoryName + "'?\n"
+        wxStringClientData* data = static_cast<wxStringClientData*>(btn->GetClientObject());
+        if (data) {
+            wxString categoryName = data->GetData();
+            int result = wxMessageBox("Apakah Anda yakin ingin menghapus kategori '" + categoryName + "'?\n"
                 "Semua aset dalam kategori ini juga akan dihapus.",
                 "Konfirmasi Hapus", wxYES_NO | wxICON_QUESTION);
 
             if (result == wxYES) {
-                DeleteCategory(*categoryName);
-                wxMessageBox("Kategori berhasil dihapus.", "Sukses", wxOK | wxICON_INFORMATION);
-                ShowMenuPage(1); // Refresh the page
+                btn->Disable();
+                StartCategoryDelete(categoryName);
             }
-            delete categoryName;
         }
     }
 }
 
+void MainFrame::StartCategoryDelete(const wxString& categoryName) {
+    // Cari node yang dihapus di worker, lepas node-nya di UI thread
+    workerPool->Submit<CategoryDeletePlan>(this,
+        [categoryName](TaskContext& context) {
+            RegistryReadLock lock;
+            return PlanDeleteCategory(categoryName, &context);
+        },
+        [this](CategoryDeletePlan& plan) {
+            if (!ApplyDeleteCategory(plan)) {
+                // Registry berubah selama perencanaan, rencanakan ulang
+                StartCategoryDelete(plan.categoryName);
+                return;
+            }
+            ClearTaskProgress();
+            wxMessageBox("Kategori berhasil dihapus.", "Sukses", wxOK | wxICON_INFORMATION);
+            if (currentMenuPage == 1) {
+                ShowMenuPage(1); // Refresh the page
+            }
+        },
+        [this](int percent) { ShowTaskProgress("Menghapus kategori", percent); });
+}
+
 void MainFrame::OnSubmitAsset(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnSubmitAsset");
     wxString assetName = assetNameInput->GetValue().Trim();
 
     if (assetName.IsEmpty()) {
@@ -2483,6 +2226,7 @@ void MainFrame::OnSubmitAsset(wxCommandEvent& event) {
 }
 
 void MainFrame::OnAssetGridClick(wxGridEvent& event) {
+    TRACE_SCOPE("MainFrame::OnAssetGridClick");
     int row = event.GetRow();
     int col = event.GetCol();
 
@@ -2509,9 +2253,11 @@ void MainFrame::OnAssetGridClick(wxGridEvent& event) {
 }
 
 void MainFrame::OnSearchAsset(wxCommandEvent& event) {
+    TRACE_SCOPE("MainFrame::OnSearchAsset");
     wxString searchTerm = searchInput->GetValue().Trim();
 
     // Clear previous results
+    pageTasks[4].Cancel();
     searchResultsSizer->Clear(true);
 
     if (searchTerm.IsEmpty()) {
@@ -2522,43 +2268,172 @@ void MainFrame::OnSearchAsset(wxCommandEvent& event) {
         return;
     }
 
-    std::vector<Aset> results = SearchAssets(searchTerm);
+    wxStaticText* searching = new wxStaticText(searchResultsPanel, wxID_ANY, "Mencari...");
+    searchResultsSizer->Add(searching, 0, wxALL, 10);
+    searchResultsPanel->Layout();
 
-    if (results.empty()) {
-        wxStaticText* noResults = new wxStaticText(searchResultsPanel, wxID_ANY,
-            "Tidak ada aset yang ditemukan.");
-        searchResultsSizer->Add(noResults, 0, wxALL, 10);
-    }
-    else {
-        wxString headerText = wxString::Format("Ditemukan %zu aset:", results.size());
-        wxStaticText* header = new wxStaticText(searchResultsPanel, wxID_ANY, headerText);
-        wxFont headerFont = header->GetFont();
-        headerFont.SetWeight(wxFONTWEIGHT_BOLD);
-        header->SetFont(headerFont);
-        searchResultsSizer->Add(header, 0, wxALL, 10);
-
-        for (const auto& asset : results) {
-            wxBoxSizer* resultSizer = new wxBoxSizer(wxHORIZONTAL);
-
-            wxString resultText = wxString::Format("ID: %s | Nama: %s | Kategori: %s",
-                asset.id, asset.nama, asset.kategori);
-            wxStaticText* resultLabel = new wxStaticText(searchResultsPanel, wxID_ANY, resultText);
-
-            // Get asset value details if available
-            Node<AssetValueDetails>* valueNode = findAssetValueById(daftarDetailNilaiAset, asset.id);
-            if (valueNode) {
-                wxString valueText = wxString::Format(" | Nilai: Rp %d", valueNode->data.currentValue);
-                resultText += valueText;
-                resultLabel->SetLabel(resultText);
+    pageTasks[4] = workerPool->Submit<std::vector<SearchResultRow>>(this,
+        [searchTerm](TaskContext& context) {
+            RegistryReadLock lock;
+            return SearchAssetsWithValues(searchTerm, &context);
+        },
+        [this](std::vector<SearchResultRow>& results) {
+            ClearTaskProgress();
+            searchResultsSizer->Clear(true);
+
+            if (results.empty()) {
+                wxStaticText* noResults = new wxStaticText(searchResultsPanel, wxID_ANY,
+                    "Tidak ada aset yang ditemukan.");
+                searchResultsSizer->Add(noResults, 0, wxALL, 10);
+            }
+            else {
+                wxString headerText = wxString::Format("Ditemukan %zu aset:", results.size());
+                wxStaticText* header = new wxStaticText(searchResultsPanel, wxID_ANY, headerText);
+                wxFont headerFont = header->GetFont();
+                headerFont.SetWeight(wxFONTWEIGHT_BOLD);
+                header->SetFont(headerFont);
+                searchResultsSizer->Add(header, 0, wxALL, 10);
+
+                for (const auto& row : results) {
+                    wxBoxSizer* resultSizer = new wxBoxSizer(wxHORIZONTAL);
+
+                    wxString resultText = wxString::Format("ID: %s | Nama: %s | Kategori: %s",
+                        GetAssetId(row.asset.key), row.asset.nama.ToWxString(), GetCategoryName(row.asset.kategori));
+
+                    // Get asset value details if available
+                    if (row.hasValue) {
+                        resultText += wxString::Format(" | Nilai: Rp %d", row.currentValue);
+                    }
+                    wxStaticText* resultLabel = new wxStaticText(searchResultsPanel, wxID_ANY, resultText);
+
+                    resultSizer->Add(resultLabel, 1, wxALIGN_CENTER_VERTICAL);
+                    searchResultsSizer->Add(resultSizer, 0, wxEXPAND | wxALL, 5);
+                }
             }
 
-            resultSizer->Add(resultLabel, 1, wxALIGN_CENTER_VERTICAL);
-            searchResultsSizer->Add(resultSizer, 0, wxEXPAND | wxALL, 5);
-        }
+            searchResultsPanel->Layout();
+            searchResultsPanel->FitInside();
+        },
+        [this](int percent) { ShowTaskProgress("Mencari aset", percent); });
+}
+
+// PERFORMANCE PAGE
+
+void MainFrame::ShowPerformancePage() {
+    wxStaticText* title = new wxStaticText(contentPanel, wxID_ANY, "Performance");
+    wxFont titleFont = title->GetFont();
+    titleFont.SetPointSize(16);
+    titleFont.SetWeight(wxFONTWEIGHT_BOLD);
+    title->SetFont(titleFont);
+    contentSizer->Add(title, 0, wxALL | wxALIGN_CENTER_HORIZONTAL, 10);
+
+#ifdef ASSETS_DISABLE_PERF
+    contentSizer->Add(new wxStaticText(contentPanel, wxID_ANY,
+        "Instrumentasi tidak dikompilasi (build dengan ASSETS_ENABLE_PERF=ON)."), 0, wxALL, 10);
+    performanceList = nullptr;
+#else
+    wxBoxSizer* controlSizer = new wxBoxSizer(wxHORIZONTAL);
+    wxCheckBox* enabledCheck = new wxCheckBox(contentPanel, wxID_ANY, "Aktifkan pengukuran");
+    enabledCheck->SetValue(IsPerfEnabled());
+    enabledCheck->Bind(wxEVT_CHECKBOX, &MainFrame::OnTogglePerformance, this);
+    wxButton* refreshBtn = new wxButton(contentPanel, wxID_ANY, "Refresh");
+    refreshBtn->Bind(wxEVT_BUTTON, &MainFrame::OnRefreshPerformance, this);
+    wxButton* resetBtn = new wxButton(contentPanel, wxID_ANY, "Reset");
+    resetBtn->Bind(wxEVT_BUTTON, &MainFrame::OnResetPerformance, this);
+
+    controlSizer->Add(enabledCheck, 0, wxALIGN_CENTER_VERTICAL | wxRIGHT, 15);
+    controlSizer->Add(refreshBtn, 0, wxRIGHT, 5);
+    controlSizer->Add(resetBtn, 0);
+    contentSizer->Add(controlSizer, 0, wxALL, 10);
+
+    // Timeline event begin/end untuk chrome://tracing atau ui.perfetto.dev
+    wxBoxSizer* traceSizer = new wxBoxSizer(wxHORIZONTAL);
+    traceButton = new wxButton(contentPanel, wxID_ANY,
+        IsTracing() ? "Stop && Simpan Trace..." : "Mulai Trace");
+    traceButton->Bind(wxEVT_BUTTON, &MainFrame::OnToggleTrace, this);
+    traceSizer->Add(traceButton, 0, wxRIGHT, 10);
+    traceSizer->Add(new wxStaticText(contentPanel, wxID_ANY,
+        "Rekam handler UI, rebuild halaman, operasi data dan task worker."), 0, wxALIGN_CENTER_VERTICAL);
+    contentSizer->Add(traceSizer, 0, wxLEFT | wxRIGHT | wxBOTTOM, 10);
+
+    // Timer dalam waktu, counter dalam jumlah; persentil dari histogram log2
+    performanceList = new wxListCtrl(contentPanel, wxID_ANY, wxDefaultPosition, wxDefaultSize,
+        wxLC_REPORT | wxLC_HRULES | wxLC_VRULES);
+    performanceList->InsertColumn(0, "Metrik", wxLIST_FORMAT_LEFT, 200);
+    performanceList->InsertColumn(1, "Jumlah", wxLIST_FORMAT_RIGHT, 70);
+    performanceList->InsertColumn(2, "Total", wxLIST_FORMAT_RIGHT, 80);
+    performanceList->InsertColumn(3, "Rata-rata", wxLIST_FORMAT_RIGHT, 80);
+    performanceList->InsertColumn(4, "p50", wxLIST_FORMAT_RIGHT, 70);
+    performanceList->InsertColumn(5, "p90", wxLIST_FORMAT_RIGHT, 70);
+    performanceList->InsertColumn(6, "p99", wxLIST_FORMAT_RIGHT, 70);
+    performanceList->InsertColumn(7, "Max", wxLIST_FORMAT_RIGHT, 70);
+    contentSizer->Add(performanceList, 1, wxEXPAND | wxALL, 10);
+
+    RefreshPerformanceList();
+#endif
+}
+
+static wxString FormatPerfValue(PerfMetricKind kind, double value) {
+    if (kind == PERF_COUNTER) return wxString::Format("%.0f", value);
+    if (value >= 1e9) return wxString::Format("%.2f s", value / 1e9);
+    if (value >= 1e6) return wxString::Format("%.2f ms", value / 1e6);
+    if (value >= 1e3) return wxString::Format("%.1f us", value / 1e3);
+    return wxString::Format("%.0f ns", value);
+}
+
+void MainFrame::RefreshPerformanceList() {
+    if (!performanceList) return;
+
+    std::vector<PerfMetricSnapshot> metrics = GetPerfSnapshot();
+    performanceList->DeleteAllItems();
+    for (size_t i = 0; i < metrics.size(); i++) {
+        const PerfMetricSnapshot& metric = metrics[i];
+        long row = performanceList->InsertItem(static_cast<long>(i), wxString(metric.name));
+        performanceList->SetItem(row, 1, wxString::Format("%llu", (unsigned long long)metric.count));
+        performanceList->SetItem(row, 2, FormatPerfValue(metric.kind, static_cast<double>(metric.total)));
+        performanceList->SetItem(row, 3, FormatPerfValue(metric.kind,
+            static_cast<double>(metric.total) / metric.count));
+        performanceList->SetItem(row, 4, FormatPerfValue(metric.kind, static_cast<double>(metric.p50)));
+        performanceList->SetItem(row, 5, FormatPerfValue(metric.kind, static_cast<double>(metric.p90)));
+        performanceList->SetItem(row, 6, FormatPerfValue(metric.kind, static_cast<double>(metric.p99)));
+        performanceList->SetItem(row, 7, FormatPerfValue(metric.kind, static_cast<double>(metric.max)));
+    }
+}
+
+void MainFrame::OnTogglePerformance(wxCommandEvent& event) {
+    SetPerfEnabled(event.IsChecked());
+}
+
+void MainFrame::OnRefreshPerformance(wxCommandEvent& event) {
+    RefreshPerformanceList();
+}
+
+void MainFrame::OnResetPerformance(wxCommandEvent& event) {
+    ResetPerfMetrics();
+    RefreshPerformanceList();
+}
+
+void MainFrame::OnToggleTrace(wxCommandEvent& event) {
+    if (!IsTracing()) {
+        StartTracing();
+        traceButton->SetLabel("Stop && Simpan Trace...");
+        return;
     }
 
-    searchResultsPanel->Layout();
-    searchResultsPanel->FitInside();
+    StopTracing();
+    traceButton->SetLabel("Mulai Trace");
+
+    wxFileDialog dialog(this, "Simpan Trace", "", "assets-trace.json",
+        "Chrome trace (*.json)|*.json", wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+    if (dialog.ShowModal() != wxID_OK) return;
+
+    size_t eventCount = GetTraceEventCount();
+    if (!WriteChromeTrace(dialog.GetPath().ToStdString())) {
+        wxMessageBox("Gagal menulis file trace.", "Error", wxOK | wxICON_ERROR);
+        return;
+    }
+    wxMessageBox(wxString::Format("%zu event disimpan.\nBuka di chrome://tracing atau ui.perfetto.dev.",
+        eventCount), "Trace", wxOK | wxICON_INFORMATION);
 }
 
 wxBEGIN_EVENT_TABLE(MainFrame, wxFrame)
@@ -3,6 +3,12 @@
 #include <wx/grid.h>
 #include <wx/scrolwin.h>
 #include <wx/choice.h>
+#include <wx/listctrl.h>
+#include <wx/simplebook.h>
+#include <memory>
+#include <vector>
+#include "WorkerPool.h"
+#include "AssetPicker.h"
 
 template <typename T> struct Node;
 template <typename T> class LinkedList;
@@ -10,18 +16,49 @@ template <typename T> struct TreeNode;
 struct AssetValueDetails;
 struct SubAsset; 
 struct TenderProject;  
+class TenderQueueListCtrl;
+struct TreeDisplayRow;
+struct SpanningForest;
 
 class MainFrame : public wxFrame
 {
 public:
     MainFrame(const wxString& title);
+    ~MainFrame();
     void ShowAssetGraphManagementPage();
     void OnSubmitConnection(wxCommandEvent& event);
     void OnDeleteConnection(wxCommandEvent& event);
     void OnViewAssetConnections(wxCommandEvent& event);
+    void OnCheckAssetCluster(wxCommandEvent& event);
+    void OnComputeSpanningForest(wxCommandEvent& event);
     void RefreshAssetDropdowns();
 
 private:
+    // Halaman menu yang disimpan di pageBook; builtStamp = data stamp saat dibangun
+    struct PageCacheEntry {
+        wxPanel* panel;
+        wxBoxSizer* sizer;
+        unsigned dependencies;
+        bool built;
+        unsigned long builtStamp;
+    };
+
+    WorkerPool* workerPool;
+    std::vector<TaskHandle> pageTasks;
+    TaskHandle billingTask;
+    // Jaringan minimum terakhir; ditandai di daftar koneksi selama datanya belum berubah
+    TaskHandle spanningTask;
+    std::shared_ptr<SpanningForest> spanningForest;
+    int currentMenuPage;
+
+    wxSimplebook* pageBook;
+    std::vector<PageCacheEntry> pageCache;
+
+    // Index autocomplete aset, dibangun ulang saat DATA_ASET berubah
+    AssetPrefixIndex assetIndex;
+    unsigned long assetIndexStamp;
+
+    // Halaman yang sedang dibangun/ditampilkan
     wxPanel* contentPanel;
     wxBoxSizer* contentSizer;
 
@@ -34,22 +71,23 @@ private:
     wxScrolledWindow* searchResultsPanel;
     wxBoxSizer* searchResultsSizer;
 
-    wxChoice* parentAssetDropdown;
+    AssetPicker* parentAssetPicker;
     wxChoice* parentSubAssetDropdown;
     wxTextCtrl* subAssetNameInput;
     wxTextCtrl* subAssetDescInput;
     wxScrolledWindow* treeDisplayPanel;
     wxBoxSizer* treeDisplaySizer;
+    wxChoice* billingMonthDropdown;
     wxScrolledWindow* recentAssetsPanel;
     wxBoxSizer* recentAssetsSizer;
 
-    wxChoice* fromAssetDropdown;
-    wxChoice* toAssetDropdown;
+    AssetPicker* fromAssetPicker;
+    AssetPicker* toAssetPicker;
     wxTextCtrl* weightInput;
     wxTextCtrl* descriptionInput;
     wxScrolledWindow* graphResultsPanel;
     wxBoxSizer* graphResultsSizer;
-    wxChoice* selectedAssetDropdown;
+    AssetPicker* selectedAssetPicker;
     wxTextCtrl* tenderProjectNameInput;
     wxChoice* tenderProjectCategoryDropdown;
     wxTextCtrl* tenderProjectDescInput;
@@ -57,20 +95,30 @@ private:
     wxTextCtrl* tenderProjectValueInput;
     wxTextCtrl* tenderProjectClientInput;
     wxChoice* tenderProjectPriorityDropdown;
-    wxScrolledWindow* tenderProjectsPanel;
-    wxBoxSizer* tenderProjectsSizer;
+    wxStaticText* tenderQueueCountLabel;
+    wxStaticText* tenderNextProjectLabel;
+    wxButton* tenderProcessButton;
+    TenderQueueListCtrl* tenderProjectsList;
+    wxListCtrl* performanceList;
+    wxButton* traceButton;
 
     void OnButtonClicked(wxCommandEvent& event);
+    void OnGeneratePortfolio(wxCommandEvent& event);
     void OnSubmitCategory(wxCommandEvent& event);
     void OnDeleteCategory(wxCommandEvent& event);
+    void OnRenameCategory(wxCommandEvent& event);
     void OnSubmitAsset(wxCommandEvent& event);
     void OnAssetGridClick(wxGridEvent& event);
     void OnSearchAsset(wxCommandEvent& event);
     void OnSubmitSubAsset(wxCommandEvent& event);
     void OnEditSubAsset(wxCommandEvent& event);
     void OnDeleteSubAsset(wxCommandEvent& event);
+    void OnMoveSubAsset(wxCommandEvent& event);
+    void OnRunBilling(wxCommandEvent& event);
 
     void ShowMenuPage(int menuNumber);
+    void RebuildPage(int pageIndex, int menuNumber);
+    void MarkPageFresh(int menuNumber);
     void ShowCategoryManagementPage();
     void ShowAssetManagementPage();
     void ShowAssetListPage();
@@ -81,21 +129,34 @@ private:
 
     void ShowEditAssetValueDialog(Node<AssetValueDetails>* node);
 
+    const AssetPrefixIndex* GetAssetIndex();
     void UpdateParentSubAssetDropdown();
     void DisplayAssetTrees();
-    void DisplayTreeNode(TreeNode<SubAsset>* node, int depth);
+    void ShowTreeDisplayRows(const std::vector<TreeDisplayRow>& rows);
     void ShowEditSubAssetDialog(SubAsset* subAsset);
+    void ShowMoveSubAssetDialog(const wxString& subAssetId);
     void ShowTenderProjectManagementPage();
     void OnSubmitTenderProject(wxCommandEvent& event);
     void OnDeleteTenderProject(wxCommandEvent& event);
     void OnUpdateTenderProjectStatus(wxCommandEvent& event);
     void OnProcessNextTenderProject(wxCommandEvent& event);
-    void ShowEditTenderProjectDialog(TenderProject* project);
+    bool ShowEditTenderProjectDialog(TenderProject* project);
     void RefreshTenderProjectsDisplay();
+    void RefreshTenderQueueSummary();
     void ShowRecentAssetsPage();
     void OnClearHistory(wxCommandEvent& event);
     void OnOpenRecentAsset(wxCommandEvent& event);
     void RefreshRecentAssetsDisplay();
+    void ShowPerformancePage();
+    void RefreshPerformanceList();
+    void OnTogglePerformance(wxCommandEvent& event);
+    void OnRefreshPerformance(wxCommandEvent& event);
+    void OnResetPerformance(wxCommandEvent& event);
+    void OnToggleTrace(wxCommandEvent& event);
+
+    void StartCategoryDelete(const wxString& categoryName);
+    void ShowTaskProgress(const wxString& label, int percent);
+    void ClearTaskProgress();
 
 
     wxDECLARE_EVENT_TABLE();
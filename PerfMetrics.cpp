@@ -0,0 +1,183 @@
+#include "PerfMetrics.h"
+#include <algorithm>
+#include <mutex>
+
+std::atomic<bool> perfEnabled(true);
+
+namespace {
+    struct PerfSlot {
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> total;
+        std::atomic<uint64_t> max;
+        std::atomic<uint64_t> buckets[PERF_BUCKET_COUNT];
+    };
+
+    // Satu blok per thread yang pernah merekam. Hanya thread pemilik yang menulis,
+    // jadi update cukup load + store relaxed; atomic hanya agar pembaca tidak data race.
+    struct PerfThreadData {
+        std::atomic<unsigned> epoch;
+        PerfSlot slots[PERF_MAX_METRICS];
+    };
+
+    struct PerfRegistry {
+        std::mutex mutex;
+        std::string names[PERF_MAX_METRICS];
+        PerfMetricKind kinds[PERF_MAX_METRICS];
+        std::atomic<size_t> metricCount;
+        std::vector<PerfThreadData*> threads;   // tidak pernah dihapus (jumlah thread kecil)
+        std::atomic<unsigned> epoch;
+
+        PerfRegistry() : metricCount(0), epoch(1) {}
+    };
+
+    PerfRegistry& Registry() {
+        static PerfRegistry registry;
+        return registry;
+    }
+
+    void ClearThreadData(PerfThreadData& data) {
+        for (PerfSlot& slot : data.slots) {
+            slot.count.store(0, std::memory_order_relaxed);
+            slot.total.store(0, std::memory_order_relaxed);
+            slot.max.store(0, std::memory_order_relaxed);
+            for (auto& bucket : slot.buckets) bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    PerfThreadData* CurrentThreadData() {
+        thread_local PerfThreadData* data = nullptr;
+        if (!data) {
+            data = new PerfThreadData();
+            ClearThreadData(*data);
+            data->epoch.store(0, std::memory_order_relaxed);
+
+            PerfRegistry& registry = Registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.threads.push_back(data);
+        }
+        return data;
+    }
+
+    void Bump(std::atomic<uint64_t>& value, uint64_t amount) {
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    size_t BucketIndex(uint64_t value) {
+        size_t index = 0;
+        while (value != 0 && index < PERF_BUCKET_COUNT - 1) {
+            value >>= 1;
+            index++;
+        }
+        return index;
+    }
+
+    uint64_t BucketUpperBound(size_t index) {
+        return index == 0 ? 0 : (uint64_t(1) << index) - 1;
+    }
+
+    uint64_t EstimatePercentile(const uint64_t* buckets, uint64_t count, uint64_t max, double percent) {
+        if (count == 0) return 0;
+        uint64_t rank = static_cast<uint64_t>(percent / 100.0 * count + 0.999999);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < PERF_BUCKET_COUNT; i++) {
+            seen += buckets[i];
+            if (seen >= rank) return std::min(BucketUpperBound(i), max);
+        }
+        return max;
+    }
+}
+
+PerfMetric::PerfMetric(const std::string& name, PerfMetricKind kind) {
+    PerfRegistry& registry = Registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    size_t count = registry.metricCount.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < count; i++) {
+        if (registry.names[i] == name) {
+            id = i;
+            this->name = registry.names[i].c_str();
+            return;
+        }
+    }
+
+    id = count;
+    this->name = "perf/registry-penuh";
+    if (count == PERF_MAX_METRICS) return;
+    registry.names[count] = name;
+    this->name = registry.names[count].c_str();
+    registry.kinds[count] = kind;
+    registry.metricCount.store(count + 1, std::memory_order_release);
+}
+
+void SetPerfEnabled(bool enabled) {
+    perfEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+void RecordPerfSample(const PerfMetric& metric, uint64_t value) {
+    if (metric.GetId() >= PERF_MAX_METRICS) return;
+
+    PerfThreadData* data = CurrentThreadData();
+    unsigned epoch = Registry().epoch.load(std::memory_order_acquire);
+    if (data->epoch.load(std::memory_order_relaxed) != epoch) {
+        ClearThreadData(*data);
+        data->epoch.store(epoch, std::memory_order_release);
+    }
+
+    PerfSlot& slot = data->slots[metric.GetId()];
+    Bump(slot.count, 1);
+    Bump(slot.total, value);
+    if (value > slot.max.load(std::memory_order_relaxed)) {
+        slot.max.store(value, std::memory_order_relaxed);
+    }
+    Bump(slot.buckets[BucketIndex(value)], 1);
+}
+
+std::vector<PerfMetricSnapshot> GetPerfSnapshot() {
+    PerfRegistry& registry = Registry();
+    size_t metricCount = registry.metricCount.load(std::memory_order_acquire);
+    unsigned epoch = registry.epoch.load(std::memory_order_acquire);
+
+    std::vector<PerfThreadData*> threads;
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        threads = registry.threads;
+    }
+
+    std::vector<PerfMetricSnapshot> snapshots;
+    for (size_t id = 0; id < metricCount; id++) {
+        uint64_t count = 0;
+        uint64_t total = 0;
+        uint64_t max = 0;
+        uint64_t buckets[PERF_BUCKET_COUNT] = {};
+
+        for (PerfThreadData* data : threads) {
+            // Thread yang belum menulis sejak reset masih menyimpan data lama
+            if (data->epoch.load(std::memory_order_acquire) != epoch) continue;
+
+            const PerfSlot& slot = data->slots[id];
+            count += slot.count.load(std::memory_order_relaxed);
+            total += slot.total.load(std::memory_order_relaxed);
+            max = std::max(max, slot.max.load(std::memory_order_relaxed));
+            for (size_t i = 0; i < PERF_BUCKET_COUNT; i++) {
+                buckets[i] += slot.buckets[i].load(std::memory_order_relaxed);
+            }
+        }
+        if (count == 0) continue;
+
+        PerfMetricSnapshot snapshot;
+        snapshot.name = registry.names[id];
+        snapshot.kind = registry.kinds[id];
+        snapshot.count = count;
+        snapshot.total = total;
+        snapshot.max = max;
+        snapshot.p50 = EstimatePercentile(buckets, count, max, 50);
+        snapshot.p90 = EstimatePercentile(buckets, count, max, 90);
+        snapshot.p99 = EstimatePercentile(buckets, count, max, 99);
+        snapshots.push_back(snapshot);
+    }
+    return snapshots;
+}
+
+void ResetPerfMetrics() {
+    Registry().epoch.fetch_add(1, std::memory_order_acq_rel);
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include "PerfTrace.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Instrumentasi hot path: timer dan counter ber-nama yang dikumpulkan ke
+// histogram per thread. Setiap thread hanya menulis slot miliknya sendiri
+// (tanpa lock, tanpa atomic read-modify-write); snapshot menjumlahkan semua
+// thread.
+//
+// Build dengan ASSETS_DISABLE_PERF menghapus semua macro PERF_*. Jika
+// dikompilasi tapi dimatikan lewat SetPerfEnabled(false), biaya per titik
+// ukur hanya satu load atomic relaxed. Saat tracing aktif (PerfTrace.h),
+// PERF_SCOPE juga muncul sebagai span di timeline.
+
+enum PerfMetricKind {
+    PERF_TIMER,     // nilai dalam nanodetik
+    PERF_COUNTER    // nilai bebas (jumlah baris, node, dll)
+};
+
+const size_t PERF_MAX_METRICS = 128;
+const size_t PERF_BUCKET_COUNT = 40;    // bucket ke-i: nilai [2^(i-1), 2^i), bucket 0 = nol
+
+// Nama yang sama selalu mendapat id yang sama, jadi beberapa titik ukur bisa
+// berbagi satu metrik. Buat sebagai static supaya registrasi hanya sekali.
+class PerfMetric {
+public:
+    PerfMetric(const std::string& name, PerfMetricKind kind);
+    size_t GetId() const { return id; }
+    const char* GetName() const { return name; }   // milik registry, tidak pernah dibebaskan
+
+private:
+    size_t id;   // PERF_MAX_METRICS jika registry penuh (sampel diabaikan)
+    const char* name;
+};
+
+struct PerfMetricSnapshot {
+    std::string name;
+    PerfMetricKind kind;
+    uint64_t count;     // jumlah sampel
+    uint64_t total;     // jumlah nilai semua sampel
+    uint64_t max;
+    uint64_t p50;       // persentil diperkirakan dari batas atas bucket
+    uint64_t p90;
+    uint64_t p99;
+};
+
+extern std::atomic<bool> perfEnabled;
+
+inline bool IsPerfEnabled() { return perfEnabled.load(std::memory_order_relaxed); }
+void SetPerfEnabled(bool enabled);
+
+void RecordPerfSample(const PerfMetric& metric, uint64_t value);
+
+// Metrik yang punya sampel sejak reset terakhir, urut sesuai registrasi
+std::vector<PerfMetricSnapshot> GetPerfSnapshot();
+
+// Reset lewat epoch: tiap thread mengosongkan slotnya sendiri saat menulis berikutnya
+void ResetPerfMetrics();
+
+class PerfScopeTimer {
+public:
+    explicit PerfScopeTimer(const PerfMetric& metric)
+        : metric(metric), active(IsPerfEnabled()), traced(IsTracing()) {
+        if (traced) RecordTraceEvent(metric.GetName(), 'B');
+        if (active) start = std::chrono::steady_clock::now();
+    }
+
+    ~PerfScopeTimer() {
+        if (traced) RecordTraceEvent(metric.GetName(), 'E');
+        if (!active) return;
+        RecordPerfSample(metric, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count()));
+    }
+
+    PerfScopeTimer(const PerfScopeTimer&) = delete;
+    PerfScopeTimer& operator=(const PerfScopeTimer&) = delete;
+
+private:
+    const PerfMetric& metric;
+    bool active;
+    bool traced;
+    std::chrono::steady_clock::time_point start;
+};
+
+#define PERF_CONCAT_INNER(a, b) a##b
+#define PERF_CONCAT(a, b) PERF_CONCAT_INNER(a, b)
+
+#ifndef ASSETS_DISABLE_PERF
+// Ukur durasi sampai akhir scope
+#define PERF_SCOPE(name) \
+    static const PerfMetric PERF_CONCAT(perfMetric_, __LINE__)(name, PERF_TIMER); \
+    PerfScopeTimer PERF_CONCAT(perfTimer_, __LINE__)(PERF_CONCAT(perfMetric_, __LINE__))
+// Sama seperti PERF_SCOPE untuk metrik yang dibuat sendiri (mis. per halaman)
+#define PERF_SCOPE_METRIC(metric) \
+    PerfScopeTimer PERF_CONCAT(perfTimer_, __LINE__)(metric)
+#define PERF_COUNT(name, value) \
+    do { \
+        static const PerfMetric perfCounter(name, PERF_COUNTER); \
+        if (IsPerfEnabled()) RecordPerfSample(perfCounter, static_cast<uint64_t>(value)); \
+    } while (0)
+#else
+#define PERF_SCOPE(name) do {} while (0)
+#define PERF_SCOPE_METRIC(metric) do {} while (0)
+#define PERF_COUNT(name, value) do {} while (0)
+#endif
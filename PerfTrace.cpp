@@ -0,0 +1,186 @@
+#include "PerfTrace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+std::atomic<bool> tracingEnabled(false);
+
+namespace {
+    struct TraceEvent {
+        const char* name;
+        uint64_t timestamp;   // nanodetik sejak TraceOrigin
+        char phase;
+    };
+
+    // Hanya thread pemilik yang menulis; head dinaikkan setelah event lengkap
+    struct TraceThreadBuffer {
+        uint32_t threadId;
+        std::string threadName;             // dijaga TraceRegistry::mutex
+        std::atomic<uint64_t> head;         // total event sejak epoch ini
+        std::atomic<unsigned> epoch;
+        TraceEvent events[TRACE_BUFFER_CAPACITY];
+    };
+
+    struct TraceRegistry {
+        std::mutex mutex;
+        std::vector<TraceThreadBuffer*> threads;   // tidak pernah dihapus
+        std::atomic<unsigned> epoch;
+
+        TraceRegistry() : epoch(1) {}
+    };
+
+    // Event paling lama di buffer penuh bisa sedang ditimpa saat trace ditulis
+    const uint64_t TRACE_OVERWRITE_MARGIN = 256;
+
+    // Sengaja tidak pernah dihancurkan: thread yang masih berjalan saat exit
+    // tetap bisa merekam, dan buffer tetap terjangkau (bukan leak)
+    TraceRegistry& Registry() {
+        static TraceRegistry* registry = new TraceRegistry();
+        return *registry;
+    }
+
+    std::chrono::steady_clock::time_point TraceOrigin() {
+        static const std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+        return origin;
+    }
+
+    // Nama dari SetTraceThreadName; dipakai saat buffer thread ini dibuat
+    thread_local std::string currentThreadName;
+    thread_local TraceThreadBuffer* currentBuffer = nullptr;
+
+    // Buffer (~1.5 MB) baru dibuat saat thread merekam event pertamanya,
+    // jadi thread yang tidak pernah di-trace tidak memakai memori
+    TraceThreadBuffer* CurrentThreadBuffer() {
+        if (!currentBuffer) {
+            TraceThreadBuffer* buffer = new TraceThreadBuffer();
+            buffer->head.store(0, std::memory_order_relaxed);
+            buffer->epoch.store(0, std::memory_order_relaxed);
+
+            TraceRegistry& registry = Registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            buffer->threadId = static_cast<uint32_t>(registry.threads.size() + 1);
+            buffer->threadName = currentThreadName;
+            registry.threads.push_back(buffer);
+            currentBuffer = buffer;
+        }
+        return currentBuffer;
+    }
+
+    void WriteJsonString(std::FILE* file, const std::string& text) {
+        std::fputc('"', file);
+        for (unsigned char c : text) {
+            if (c == '"' || c == '\\') {
+                std::fputc('\\', file);
+                std::fputc(c, file);
+            }
+            else if (c < 0x20) {
+                std::fprintf(file, "\\u%04x", c);
+            }
+            else {
+                std::fputc(c, file);
+            }
+        }
+        std::fputc('"', file);
+    }
+}
+
+void StartTracing() {
+    TraceOrigin();
+    Registry().epoch.fetch_add(1, std::memory_order_acq_rel);
+    tracingEnabled.store(true, std::memory_order_relaxed);
+}
+
+void StopTracing() {
+    tracingEnabled.store(false, std::memory_order_relaxed);
+}
+
+void SetTraceThreadName(const std::string& name) {
+    std::lock_guard<std::mutex> lock(Registry().mutex);
+    currentThreadName = name;
+    if (currentBuffer) currentBuffer->threadName = name;
+}
+
+void RecordTraceEvent(const char* name, char phase) {
+    uint64_t timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - TraceOrigin()).count());
+
+    TraceThreadBuffer* buffer = CurrentThreadBuffer();
+    unsigned epoch = Registry().epoch.load(std::memory_order_acquire);
+    if (buffer->epoch.load(std::memory_order_relaxed) != epoch) {
+        buffer->head.store(0, std::memory_order_relaxed);
+        buffer->epoch.store(epoch, std::memory_order_release);
+    }
+
+    uint64_t head = buffer->head.load(std::memory_order_relaxed);
+    TraceEvent& event = buffer->events[head % TRACE_BUFFER_CAPACITY];
+    event.name = name;
+    event.timestamp = timestamp;
+    event.phase = phase;
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+size_t GetTraceEventCount() {
+    TraceRegistry& registry = Registry();
+    unsigned epoch = registry.epoch.load(std::memory_order_acquire);
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    size_t count = 0;
+    for (TraceThreadBuffer* buffer : registry.threads) {
+        if (buffer->epoch.load(std::memory_order_acquire) != epoch) continue;
+        uint64_t head = buffer->head.load(std::memory_order_acquire);
+        count += static_cast<size_t>(std::min<uint64_t>(head, TRACE_BUFFER_CAPACITY));
+    }
+    return count;
+}
+
+bool WriteChromeTrace(const std::string& path) {
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) return false;
+
+    TraceRegistry& registry = Registry();
+    unsigned epoch = registry.epoch.load(std::memory_order_acquire);
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    std::fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    bool first = true;
+    for (TraceThreadBuffer* buffer : registry.threads) {
+        if (buffer->epoch.load(std::memory_order_acquire) != epoch) continue;
+
+        std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+            first ? "" : ",\n", buffer->threadId);
+        WriteJsonString(file, buffer->threadName.empty()
+            ? "Thread " + std::to_string(buffer->threadId) : buffer->threadName);
+        std::fprintf(file, "}}");
+        first = false;
+
+        uint64_t head = buffer->head.load(std::memory_order_acquire);
+        uint64_t start = head > TRACE_BUFFER_CAPACITY ? head - TRACE_BUFFER_CAPACITY + TRACE_OVERWRITE_MARGIN : 0;
+
+        // Buffer yang sudah berputar bisa diawali 'E' tanpa pasangan; lewati
+        uint64_t depth = 0;
+        for (uint64_t i = start; i < head; i++) {
+            const TraceEvent& event = buffer->events[i % TRACE_BUFFER_CAPACITY];
+            if (event.phase == 'E') {
+                if (depth == 0) continue;
+                depth--;
+            }
+            else {
+                depth++;
+            }
+
+            std::fprintf(file, ",\n{\"name\":");
+            WriteJsonString(file, event.name);
+            std::fprintf(file, ",\"cat\":\"assets\",\"ph\":\"%c\",\"ts\":%llu.%03u,\"pid\":1,\"tid\":%u}",
+                event.phase, (unsigned long long)(event.timestamp / 1000),
+                static_cast<unsigned>(event.timestamp % 1000), buffer->threadId);
+        }
+    }
+    std::fprintf(file, "\n]}\n");
+
+    bool ok = std::ferror(file) == 0;
+    std::fclose(file);
+    return ok;
+}
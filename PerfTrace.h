@@ -0,0 +1,60 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+// Tracing timeline: event begin/end per thread ke ring buffer milik thread
+// itu sendiri, lalu ditulis sebagai Chrome trace-event JSON (chrome://tracing
+// atau ui.perfetto.dev). Saat tracing mati biayanya satu load atomic relaxed.
+//
+// Nama event harus tetap hidup sampai trace ditulis: string literal atau nama
+// PerfMetric (disimpan registry selamanya).
+
+const size_t TRACE_BUFFER_CAPACITY = 65536;   // event per thread, yang lama ditimpa
+
+extern std::atomic<bool> tracingEnabled;
+
+inline bool IsTracing() { return tracingEnabled.load(std::memory_order_relaxed); }
+
+// Kosongkan semua buffer lalu mulai merekam
+void StartTracing();
+void StopTracing();
+
+// Nama thread di trace viewer (mis. "UI", "Worker"); tidak membuat buffer
+void SetTraceThreadName(const std::string& name);
+
+void RecordTraceEvent(const char* name, char phase);
+
+// Jumlah event yang masih ada di semua buffer
+size_t GetTraceEventCount();
+
+// Tulis event yang terekam sejak StartTracing; false jika file gagal dibuka
+bool WriteChromeTrace(const std::string& path);
+
+class TraceScope {
+public:
+    explicit TraceScope(const char* name) : name(name), active(IsTracing()) {
+        if (active) RecordTraceEvent(name, 'B');
+    }
+
+    ~TraceScope() {
+        if (active) RecordTraceEvent(name, 'E');
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name;
+    bool active;
+};
+
+#ifndef ASSETS_DISABLE_PERF
+// Span di timeline tanpa histogram (handler UI, operasi data)
+#define TRACE_SCOPE(name) TraceScope PERF_TRACE_CONCAT(traceScope_, __LINE__)(name)
+#else
+#define TRACE_SCOPE(name) do {} while (0)
+#endif
+
+#define PERF_TRACE_CONCAT_INNER(a, b) a##b
+#define PERF_TRACE_CONCAT(a, b) PERF_TRACE_CONCAT_INNER(a, b)
@@ -0,0 +1,346 @@
+#include "PortfolioGenerator.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+namespace {
+    const char* BASE_CATEGORIES[] = {
+        "Kost", "Gedung", "Rumah", "Emas", "Kendaraan", "Elektronik", "Ruko", "Apartemen",
+        "Tanah", "Gudang", "Villa", "Hotel", "Kios", "Pabrik", "Mesin", "Saham",
+        "Obligasi", "Perhiasan", "Kapal", "Lahan"
+    };
+    const char* NAME_WORDS[] = {
+        "Melati", "Mawar", "Anggrek", "Kenanga", "Cempaka", "Dahlia", "Flamboyan", "Teratai",
+        "Kamboja", "Sakura", "Tulip", "Cendana"
+    };
+    const char* CITY_NAMES[] = {
+        "Jakarta", "Bandung", "Surabaya", "Medan", "Semarang", "Makassar", "Depok", "Bogor",
+        "Malang", "Yogyakarta"
+    };
+    const char* UNIT_WORDS[] = { "Kamar", "Lantai", "Unit", "Blok", "Ruang", "Lot" };
+    const char* RENTER_NAMES[] = {
+        "Budi", "Siti", "Andi", "Dewi", "Rina", "Agus", "Putri", "Joko", "Lestari", "Hendra"
+    };
+    const char* CLIENT_NAMES[] = {
+        "PT Maju Jaya", "CV Sinar Abadi", "PT Karya Bangun", "Pemda Kota", "PT Nusantara Prima",
+        "Yayasan Harapan"
+    };
+    const char* TENDER_STATUSES[] = { "Pending", "In Review", "Approved", "Rejected" };
+
+    template <typename T, size_t N>
+    size_t CountOf(T(&)[N]) { return N; }
+
+    // Bobot Zipf: ukuran ke-k sebanding dengan 1 / k^skew
+    std::discrete_distribution<size_t> ZipfDistribution(size_t count, double skew) {
+        std::vector<double> weights(count);
+        for (size_t k = 0; k < count; k++) {
+            weights[k] = 1.0 / std::pow(static_cast<double>(k + 1), skew);
+        }
+        return std::discrete_distribution<size_t>(weights.begin(), weights.end());
+    }
+
+    int ClampToInt(double value) {
+        return static_cast<int>(std::max(0.0, std::min(2000000000.0, value)));
+    }
+
+    wxString RandomDate(std::mt19937_64& random) {
+        std::uniform_int_distribution<int> dayOf(1, 28), monthOf(1, 12), yearOf(2024, 2026);
+        int day = dayOf(random);
+        int month = monthOf(random);
+        int year = yearOf(random);
+        return wxString::Format("%02d/%02d/%04d", day, month, year);
+    }
+
+    // Cek pembatalan dan kirim progress setiap TASK_CHECK_INTERVAL langkah
+    class GenerationProgress {
+    public:
+        GenerationProgress(TaskContext* context, size_t total)
+            : context(context), total(std::max<size_t>(1, total)), done(0) {
+        }
+
+        bool Step() {
+            if (!context || (++done % TASK_CHECK_INTERVAL) != 0) return true;
+            if (context->IsCancelled()) return false;
+            context->ReportProgress(static_cast<int>(std::min<size_t>(99, done * 100 / total)));
+            return true;
+        }
+
+    private:
+        TaskContext* context;
+        size_t total;
+        size_t done;
+    };
+}
+
+PortfolioSpec DefaultPortfolioSpec(size_t assetCount, unsigned seed) {
+    PortfolioSpec spec;
+    spec.seed = seed;
+    spec.categoryCount = 20;
+    spec.assetCount = assetCount;
+    spec.categorySkew = 1.1;
+    spec.connectionsPerAsset = 2;
+    spec.subAssetCount = assetCount * 2;
+    spec.treeCount = std::max<size_t>(1, assetCount / 10);
+    spec.treeSkew = 0.8;
+    spec.maxTreeDepth = 12;
+    spec.deepAttachChance = 0.35;
+    spec.rentedFraction = 0.6;
+    spec.tenderCount = std::max<size_t>(10, assetCount / 20);
+    spec.historyCount = 15;
+    return spec;
+}
+
+void Portfolio::Clear() {
+    for (AssetTree<SubAssetHandle>* tree : trees) {
+        delete tree;
+    }
+    trees.clear();
+    subAset.clear();
+    subAssetIndex.clear();
+    subAssetPool.clear();
+    ledger.clear();
+    koneksi.clear();
+    nilaiAset.clear();
+    aset.clear();
+    kategori.clear();
+    tenders.clear();
+    history.clear();
+    assetKeys.clear();
+    subAssetKeys.clear();
+    tenderKeys.clear();
+}
+
+bool GeneratePortfolio(const PortfolioSpec& spec, Portfolio& portfolio, TaskContext* context) {
+    portfolio.Clear();
+    std::mt19937_64 random(spec.seed);
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+
+    size_t assetCount = spec.assetCount;
+    size_t treeCount = assetCount == 0 ? 0 : std::min(spec.treeCount, assetCount);
+    GenerationProgress progress(context, assetCount * (1 + spec.connectionsPerAsset) +
+        (treeCount ? spec.subAssetCount * 2 : 0) + spec.tenderCount);
+
+    // KATEGORI: nama dasar dulu, sisanya bernomor
+    size_t categoryCount = std::max<size_t>(1, spec.categoryCount);
+    std::vector<wxString> categories;
+    std::vector<CategoryId> categoryIds;
+    std::vector<wxString> prefixes;
+    for (size_t i = 0; i < categoryCount; i++) {
+        wxString name = i < CountOf(BASE_CATEGORIES) ? wxString(BASE_CATEGORIES[i])
+            : wxString::Format("Kategori %03zu", i + 1);
+        categories.push_back(name);
+        // Prefix dua huruf, aturan yang sama dengan GenerateUniqueAssetId
+        prefixes.push_back(name.SubString(0, 1).Upper());
+        categoryIds.push_back(portfolio.kategori.Add(name));
+    }
+
+    // ASET + NILAI: ukuran kategori mengikuti Zipf, ID sama dengan GenerateUniqueAssetId
+    std::discrete_distribution<size_t> pickCategory = ZipfDistribution(categoryCount, spec.categorySkew);
+    std::lognormal_distribution<double> assetValue(std::log(250000.0), 1.0);
+    StringIndexMap prefixCounters;
+    std::vector<const Aset*> assets;
+    assets.reserve(assetCount);
+
+    for (size_t i = 0; i < assetCount; i++) {
+        if (!progress.Step()) return false;
+
+        // Setiap angka acak diambil di statement sendiri: urutan evaluasi argumen
+        // fungsi tidak ditentukan, padahal output harus sama di semua compiler
+        size_t category = pickCategory(random);
+        size_t word = random() % CountOf(NAME_WORDS);
+        size_t city = random() % CountOf(CITY_NAMES);
+        size_t number = ++prefixCounters[prefixes[category]];
+        wxString id = prefixes[category] + wxString::Format("%04zu", number);
+        wxString nama = wxString::Format("%s %s %s %zu", categories[category],
+            NAME_WORDS[word], CITY_NAMES[city], number);
+
+        EntityKey key = portfolio.assetKeys.Intern(id);
+        portfolio.aset.emplace_back(key, nama, categoryIds[category]);
+        portfolio.kategori.AttachAsset(portfolio.aset.getTail());
+        assets.push_back(&portfolio.aset.getTail()->data);
+
+        int value = ClampToInt(assetValue(random));
+        portfolio.nilaiAset.emplace_back(key, value,
+            ClampToInt(value * (0.01 + 0.02 * chance(random))), ClampToInt(value * 0.005));
+    }
+
+    // KONEKSI: Barabasi-Albert. Target dipilih dari daftar endpoint edge, jadi
+    // peluang terpilih sebanding dengan degree (preferential attachment).
+    std::vector<uint32_t> endpoints;
+    endpoints.reserve(assetCount * spec.connectionsPerAsset * 2);
+    std::vector<uint32_t> chosen;
+    for (size_t i = 1; i < assetCount; i++) {
+        size_t targets = std::min(spec.connectionsPerAsset, i);
+        chosen.clear();
+
+        for (size_t t = 0; t < targets; t++) {
+            if (!progress.Step()) return false;
+
+            uint32_t target = 0;
+            bool found = false;
+            for (int attempt = 0; attempt < 8 && !found; attempt++) {
+                if (!endpoints.empty() && attempt < 6) {
+                    target = endpoints[random() % endpoints.size()];
+                }
+                else {
+                    target = static_cast<uint32_t>(random() % i);
+                }
+                found = std::find(chosen.begin(), chosen.end(), target) == chosen.end();
+            }
+            if (!found) continue;
+
+            chosen.push_back(target);
+            portfolio.koneksi.emplace_back(assets[i]->key, assets[target]->key,
+                1 + static_cast<int>(random() % 10));
+            endpoints.push_back(static_cast<uint32_t>(i));
+            endpoints.push_back(target);
+        }
+    }
+    std::vector<uint32_t>().swap(endpoints);
+
+    // SUB-ASET: ukuran tree mengikuti Zipf (beberapa tree sangat lebar), node baru
+    // kadang jadi anak node terakhir supaya ada rantai yang dalam
+    if (treeCount > 0) {
+        std::vector<AssetTree<SubAssetHandle>*> trees(treeCount);
+        std::vector<std::vector<TreeNode<SubAssetHandle>*>> treeNodes(treeCount);
+        std::vector<std::vector<uint16_t>> treeDepths(treeCount);
+
+        for (size_t t = 0; t < treeCount; t++) {
+            const Aset* owner = assets[t * assetCount / treeCount];
+            wxString ownerId = portfolio.assetKeys.GetId(owner->key);
+            trees[t] = new AssetTree<SubAssetHandle>();
+            TreeNode<SubAssetHandle>* root = trees[t]->createNode(portfolio.subAssetPool.create(
+                portfolio.subAssetKeys.Intern("ROOT-" + ownerId), "Root of " + owner->nama, owner->key));
+            trees[t]->setRoot(root);
+            portfolio.trees.push_back(trees[t]);
+            treeNodes[t].push_back(root);
+            treeDepths[t].push_back(0);
+        }
+
+        std::discrete_distribution<size_t> pickTree = ZipfDistribution(treeCount, spec.treeSkew);
+        std::lognormal_distribution<double> rentalPrice(std::log(1500000.0), 0.5);
+        size_t maxDepth = std::max<size_t>(1, spec.maxTreeDepth);
+
+        for (size_t i = 0; i < spec.subAssetCount; i++) {
+            if (!progress.Step()) return false;
+
+            size_t t = pickTree(random);
+            std::vector<TreeNode<SubAssetHandle>*>& nodes = treeNodes[t];
+            std::vector<uint16_t>& depths = treeDepths[t];
+
+            size_t parent = nodes.size() - 1;
+            if (chance(random) >= spec.deepAttachChance || depths[parent] >= maxDepth) {
+                parent = random() % nodes.size();
+                for (int attempt = 0; attempt < 4 && depths[parent] >= maxDepth; attempt++) {
+                    parent = random() % nodes.size();
+                }
+                if (depths[parent] >= maxDepth) parent = 0;
+            }
+
+            EntityKey assetKey = portfolio.subAssetPool.get(trees[t]->getRoot()->data).parentKey;
+            size_t unit = random() % CountOf(UNIT_WORDS);
+            wxString id = portfolio.assetKeys.GetId(assetKey) + wxString::Format("-SUB%03zu", nodes.size());
+            wxString nama = wxString::Format("%s %zu", UNIT_WORDS[unit], nodes.size());
+            SubAssetHandle handle = portfolio.subAssetPool.create(portfolio.subAssetKeys.Intern(id), nama, assetKey);
+            if (chance(random) < spec.rentedFraction) {
+                SubAsset& subAsset = portfolio.subAssetPool.get(handle);
+                subAsset.isRented = true;
+                subAsset.renterName = RENTER_NAMES[random() % CountOf(RENTER_NAMES)];
+                subAsset.rentalPrice = ClampToInt(rentalPrice(random));
+            }
+
+            portfolio.subAset.push_back(handle);
+            TreeNode<SubAssetHandle>* node = trees[t]->createNode(handle);
+            nodes[parent]->addChild(node);
+            nodes.push_back(node);
+            depths.push_back(static_cast<uint16_t>(depths[parent] + 1));
+        }
+
+        // RIWAYAT SEWA: 0-2 lease selesai per unit sejak awal 2024, lalu lease
+        // berjalan untuk unit yang sedang disewa. Generator acak sendiri supaya
+        // data lain tetap sama dengan sebelum ada ledger.
+        std::mt19937_64 leaseRandom(spec.seed ^ 0x5EA5E5ull);
+        std::uniform_int_distribution<int> vacancyDays(0, 120), leaseDays(60, 480);
+        const LedgerDay historyStart = LedgerDayFromDate(2024, 1, 1);
+        const LedgerDay historyEnd = LedgerDayFromDate(2026, 10, 1);
+        for (SubAssetHandle handle : portfolio.subAset) {
+            if (!progress.Step()) return false;
+            const SubAsset& subAsset = portfolio.subAssetPool.get(handle);
+            LedgerDay cursor = historyStart + vacancyDays(leaseRandom) * 3;
+            size_t pastLeases = leaseRandom() % 3;
+            for (size_t l = 0; l < pastLeases && cursor < historyEnd; l++) {
+                LedgerDay end = std::min(historyEnd, cursor + leaseDays(leaseRandom));
+                const char* renter = RENTER_NAMES[leaseRandom() % CountOf(RENTER_NAMES)];
+                int price = ClampToInt(rentalPrice(leaseRandom));
+                portfolio.ledger.AddLeaseUnindexed(subAsset.key, cursor, end, price, renter);
+                cursor = end + vacancyDays(leaseRandom);
+            }
+            if (subAsset.isRented) {
+                portfolio.ledger.AddLeaseUnindexed(subAsset.key, std::min(cursor, historyEnd), LEASE_OPEN_END,
+                    subAsset.rentalPrice, subAsset.renterName.ToWxString());
+            }
+        }
+        portfolio.ledger.RebuildIndex();
+    }
+
+    // TENDER
+    std::lognormal_distribution<double> tenderValue(std::log(50000000.0), 1.2);
+    std::discrete_distribution<size_t> pickStatus({ 5.0, 3.0, 1.5, 1.0 });
+    for (size_t i = 0; i < spec.tenderCount; i++) {
+        if (!progress.Step()) return false;
+
+        const wxString& kategori = categories[pickCategory(random)];
+        size_t city = random() % CountOf(CITY_NAMES);
+        size_t status = pickStatus(random);
+        wxString date = RandomDate(random);
+        int value = ClampToInt(tenderValue(random));
+        size_t client = random() % CountOf(CLIENT_NAMES);
+        int priority = 1 + static_cast<int>(random() % 5);
+
+        portfolio.tenders.emplace(portfolio.tenderKeys.Intern(wxString::Format("TG%07zu", i + 1)),
+            wxString::Format("Proyek %s %s", kategori, CITY_NAMES[city]),
+            kategori, "", TENDER_STATUSES[status], date, value, CLIENT_NAMES[client], priority);
+    }
+
+    // HISTORY
+    for (size_t i = 0; i < spec.historyCount && assetCount > 0; i++) {
+        const Aset* asset = assets[random() % assetCount];
+        wxString date = RandomDate(random);
+        int hour = static_cast<int>(random() % 24);
+        int minute = static_cast<int>(random() % 60);
+        wxString time = date + wxString::Format(" %02d:%02d", hour, minute);
+        portfolio.history.push_back(AssetHistory(portfolio.assetKeys.GetId(asset->key), asset->nama, "Asset", time));
+    }
+
+    // Index dibangun di sini supaya LoadPortfolio tetap cukup swap
+    portfolio.subAssetIndex.Rebuild(portfolio.trees, portfolio.subAset);
+    return true;
+}
+
+void LoadPortfolio(Portfolio& portfolio) {
+    RegistryWriteLock lock(DATA_KATEGORI | DATA_ASET | DATA_NILAI_ASET |
+        DATA_KONEKSI | DATA_SUB_ASET | DATA_HISTORY | DATA_TENDER);
+
+    assetKeys.swap(portfolio.assetKeys);
+    subAssetKeys.swap(portfolio.subAssetKeys);
+    tenderKeys.swap(portfolio.tenderKeys);
+    daftarKategori.swap(portfolio.kategori);
+    daftarAset.swap(portfolio.aset);
+    daftarDetailNilaiAset.swap(portfolio.nilaiAset);
+    daftarKoneksiAset.swap(portfolio.koneksi);
+    assetClusters.Invalidate();
+    subAssetPool.swap(portfolio.subAssetPool);
+    daftarSubAset.swap(portfolio.subAset);
+    assetTrees.swap(portfolio.trees);
+    subAssetIndex.swap(portfolio.subAssetIndex);
+    rentalLedger.swap(portfolio.ledger);
+    queueTenderProjects.swap(portfolio.tenders);
+
+    assetHistoryStack.clear();
+    for (auto& item : portfolio.history) {
+        assetHistoryStack.push(std::move(item));
+    }
+    portfolio.history.clear();
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "AssetEngine.h"
+
+// Generator portofolio sintetis untuk uji beban. Output ditentukan sepenuhnya
+// oleh PortfolioSpec (termasuk seed), jadi ukuran dan isi data bisa diulang
+// persis di aplikasi maupun benchmark.
+
+struct PortfolioSpec {
+    unsigned seed;
+    size_t categoryCount;
+    size_t assetCount;
+    double categorySkew;          // eksponen Zipf ukuran kategori (0 = rata)
+    size_t connectionsPerAsset;   // m pada model Barabasi-Albert (graph scale-free)
+    size_t subAssetCount;
+    size_t treeCount;             // jumlah aset yang punya tree sub-aset
+    double treeSkew;              // eksponen Zipf ukuran tree
+    size_t maxTreeDepth;
+    double deepAttachChance;      // peluang node baru jadi anak node terakhir (tree dalam)
+    double rentedFraction;
+    size_t tenderCount;
+    size_t historyCount;          // dibatasi kapasitas assetHistoryStack
+};
+
+// Spec standar untuk jumlah aset tertentu; jumlah data lain diturunkan dari assetCount
+PortfolioSpec DefaultPortfolioSpec(size_t assetCount, unsigned seed = 42);
+
+// Data hasil generate, terpisah dari registry global sehingga bisa dibuat di worker
+struct Portfolio {
+    EntityKeyMap assetKeys;
+    EntityKeyMap subAssetKeys;
+    EntityKeyMap tenderKeys;
+    CategoryDictionary kategori;
+    LinkedList<Aset> aset;
+    LinkedList<AssetValueDetails> nilaiAset;
+    LinkedList<AssetConnection> koneksi;
+    ObjectPool<SubAsset> subAssetPool;
+    LinkedList<SubAssetHandle> subAset;
+    LinkedList<AssetTree<SubAssetHandle>*> trees;
+    SubAssetIndex subAssetIndex;
+    RentalLedger ledger;
+    Queue<TenderProject> tenders;
+    std::vector<AssetHistory> history;   // urutan lama -> baru
+
+    Portfolio() : subAssetIndex(subAssetPool) {}
+
+    void Clear();
+    ~Portfolio() { Clear(); }
+};
+
+// false jika dibatalkan lewat context (isi portfolio tidak lengkap)
+bool GeneratePortfolio(const PortfolioSpec& spec, Portfolio& portfolio, TaskContext* context = nullptr);
+
+// Tukar isi registry dengan portfolio dalam satu write lock, O(1) per struktur.
+// Data lama berpindah ke portfolio dan ikut terhapus saat portfolio di-Clear.
+void LoadPortfolio(Portfolio& portfolio);
@@ -0,0 +1,269 @@
+#include "RentalBilling.h"
+#include "PerfMetrics.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+    const size_t BILLING_CHUNK_NODES = 8192;
+
+    // Satu potongan: rentang preorder beberapa tree berurutan (tree besar dipecah)
+    // plus buffer hasilnya, hanya disentuh oleh thread yang mengerjakannya
+    struct BillingChunk {
+        std::vector<ArrayView<TreeNode<SubAssetHandle>*>> ranges;
+        size_t nodeCount = 0;
+        std::vector<InvoiceLine> lines;
+        std::string text;
+        std::unordered_map<StringHandle, RenterTotal> renters;
+    };
+
+    void appendText(std::string& text, std::string_view value) {
+        text.append(value.data(), value.size());
+        text += '\0';
+    }
+
+    void billRange(BillingChunk& chunk, ArrayView<TreeNode<SubAssetHandle>*> nodes,
+        LedgerDay monthStart, LedgerDay monthEnd) {
+        LedgerDay days = monthEnd - monthStart;
+        for (TreeNode<SubAssetHandle>* node : nodes) {
+            const SubAsset& subAsset = subAssetPool.get(node->data);
+            // Rantai lease unit dari yang terbaru; dibalik supaya invoice urut waktu
+            size_t first = chunk.lines.size();
+            size_t textOffset = chunk.text.size();
+            for (LeaseId id = rentalLedger.GetLatestLease(subAsset.key); id != NO_LEASE;) {
+                const Lease& lease = rentalLedger.Get(id);
+                id = lease.previousForUnit;
+                if (!lease.Overlaps(monthStart, monthEnd)) continue;
+
+                InvoiceLine line;
+                line.assetKey = subAsset.parentKey;
+                line.subAssetKey = subAsset.key;
+                line.renterName = lease.renterName;
+                line.monthlyPrice = lease.monthlyPrice;
+                line.startDay = std::max(monthStart, lease.startDay);
+                line.endDay = std::min(monthEnd, lease.endDay);
+                line.amount = (static_cast<long long>(lease.monthlyPrice) * (line.endDay - line.startDay) + days / 2) / days;
+                line.textOffset = textOffset;
+                chunk.lines.push_back(line);
+
+                RenterTotal& total = chunk.renters.try_emplace(lease.renterName.GetHandle(),
+                    RenterTotal{ lease.renterName, 0, 0 }).first->second;
+                total.lineCount++;
+                total.amount += line.amount;
+            }
+            if (chunk.lines.size() == first) continue;
+            std::reverse(chunk.lines.begin() + first, chunk.lines.end());
+            // Teks unit disalin sekali, dipakai bersama semua baris unit ini
+            appendText(chunk.text, assetKeys.GetUtf8(subAsset.parentKey));
+            appendText(chunk.text, subAssetKeys.GetUtf8(subAsset.key));
+            appendText(chunk.text, subAsset.nama.View());
+        }
+    }
+}
+
+BillingRun RunMonthlyBilling(int year, int month, WorkerPool* pool, TaskContext* context) {
+    PERF_SCOPE("RunMonthlyBilling");
+    BillingRun run;
+    run.year = year;
+    run.month = month;
+    LedgerDay monthStart = LedgerDayFromDate(year, month, 1);
+    LedgerDay monthEnd = month == 12 ? LedgerDayFromDate(year + 1, 1, 1) : LedgerDayFromDate(year, month + 1, 1);
+    run.daysInMonth = monthEnd - monthStart;
+    run.proratedLines = 0;
+    run.totalAmount = 0;
+    run.cancelled = false;
+
+    // Potongan berisi ~BILLING_CHUNK_NODES node preorder (tanpa root) dari tree berurutan
+    std::vector<BillingChunk> chunks(1);
+    for (AssetTree<SubAssetHandle>* tree : assetTrees) {
+        if (!tree->getRoot()) continue;
+        ArrayView<TreeNode<SubAssetHandle>*> nodes = tree->getSubtree(tree->getRoot());
+        for (size_t begin = 1; begin < nodes.size();) {
+            if (chunks.back().nodeCount >= BILLING_CHUNK_NODES) chunks.emplace_back();
+            BillingChunk& chunk = chunks.back();
+            size_t count = std::min(BILLING_CHUNK_NODES - chunk.nodeCount, nodes.size() - begin);
+            chunk.ranges.push_back(ArrayView<TreeNode<SubAssetHandle>*>(nodes.begin() + begin, count));
+            chunk.nodeCount += count;
+            begin += count;
+        }
+    }
+
+    std::atomic<size_t> billed{ 0 };
+    auto body = [&](size_t index) {
+        if (context && context->IsCancelled()) return;
+        for (ArrayView<TreeNode<SubAssetHandle>*> nodes : chunks[index].ranges) {
+            billRange(chunks[index], nodes, monthStart, monthEnd);
+        }
+        size_t done = billed.fetch_add(1) + 1;
+        if (context) context->ReportProgress(static_cast<int>(done * 100 / chunks.size()));
+    };
+    if (pool) {
+        pool->ParallelFor(chunks.size(), body);
+    }
+    else {
+        for (size_t i = 0; i < chunks.size(); i++) body(i);
+    }
+    if (context && context->IsCancelled()) {
+        run.cancelled = true;
+        return run;
+    }
+
+    // Gabung urut potongan supaya hasil tidak bergantung pada jadwal thread
+    size_t lineCount = 0;
+    size_t textBytes = 0;
+    for (const BillingChunk& chunk : chunks) {
+        lineCount += chunk.lines.size();
+        textBytes += chunk.text.size();
+    }
+    run.lines.reserve(lineCount);
+    run.text.reserve(textBytes);
+    std::unordered_map<StringHandle, RenterTotal> renters;
+    for (BillingChunk& chunk : chunks) {
+        size_t base = run.text.size();
+        for (InvoiceLine& line : chunk.lines) line.textOffset += base;
+        run.lines.insert(run.lines.end(), chunk.lines.begin(), chunk.lines.end());
+        run.text += chunk.text;
+        std::vector<InvoiceLine>().swap(chunk.lines);
+        std::string().swap(chunk.text);
+        for (const auto& entry : chunk.renters) {
+            RenterTotal& total = renters.try_emplace(entry.first, RenterTotal{ entry.second.renterName, 0, 0 }).first->second;
+            total.lineCount += entry.second.lineCount;
+            total.amount += entry.second.amount;
+        }
+    }
+    for (const InvoiceLine& line : run.lines) {
+        if (line.endDay - line.startDay < run.daysInMonth) run.proratedLines++;
+        run.totalAmount += line.amount;
+    }
+
+    for (const auto& entry : renters) run.renters.push_back(entry.second);
+    std::sort(run.renters.begin(), run.renters.end(), [](const RenterTotal& a, const RenterTotal& b) {
+        return std::strcmp(a.renterName.Utf8(), b.renterName.Utf8()) < 0;
+        });
+    return run;
+}
+
+namespace {
+    // Buffer tulis CSV; di-flush ke file setiap ~1 MB
+    class CsvWriter {
+    public:
+        explicit CsvWriter(std::FILE* file) : file(file) { buffer.reserve(FLUSH_BYTES + 4096); }
+        ~CsvWriter() { Flush(); }
+
+        void Field(const char* utf8, size_t length) {
+            Separator();
+            // Kutip hanya jika perlu (koma, kutip, baris baru); teks tidak harus diakhiri nol
+            bool quote = false;
+            for (size_t i = 0; i < length && !quote; i++) {
+                quote = utf8[i] == ',' || utf8[i] == '"' || utf8[i] == '\n';
+            }
+            if (!quote) {
+                buffer.append(utf8, length);
+                return;
+            }
+            buffer += '"';
+            for (size_t i = 0; i < length; i++) {
+                if (utf8[i] == '"') buffer += '"';
+                buffer += utf8[i];
+            }
+            buffer += '"';
+        }
+        void Field(std::string_view text) { Field(text.data(), text.size()); }
+        // Angka dan tanggal tanpa snprintf; jutaan baris per tagihan
+        void Number(long long value) {
+            char text[24];
+            char* end = std::to_chars(text, text + sizeof(text), value).ptr;
+            Field(text, static_cast<size_t>(end - text));
+        }
+        void Date(LedgerDay day) {
+            int year, month, dayOfMonth;
+            LedgerDateFromDay(day, year, month, dayOfMonth);
+            char text[10] = { static_cast<char>('0' + dayOfMonth / 10), static_cast<char>('0' + dayOfMonth % 10), '/',
+                static_cast<char>('0' + month / 10), static_cast<char>('0' + month % 10), '/',
+                static_cast<char>('0' + year / 1000 % 10), static_cast<char>('0' + year / 100 % 10),
+                static_cast<char>('0' + year / 10 % 10), static_cast<char>('0' + year % 10) };
+            Field(text, sizeof(text));
+        }
+        void EndRow() {
+            buffer += '\n';
+            rowStarted = false;
+            if (buffer.size() >= FLUSH_BYTES) Flush();
+        }
+        void Flush() {
+            if (!buffer.empty()) std::fwrite(buffer.data(), 1, buffer.size(), file);
+            buffer.clear();
+        }
+
+    private:
+        static const size_t FLUSH_BYTES = 1 << 20;
+
+        void Separator() {
+            if (rowStarted) buffer += ',';
+            rowStarted = true;
+        }
+
+        std::FILE* file;
+        std::string buffer;
+        bool rowStarted = false;
+    };
+}
+
+bool WriteBillingRun(const BillingRun& run, const std::string& path) {
+    PERF_SCOPE("WriteBillingRun");
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) return false;
+    {
+        CsvWriter csv(file);
+        csv.Field("aset");
+        csv.Field("sub_aset");
+        csv.Field("unit");
+        csv.Field("penyewa");
+        csv.Field("harga_bulanan");
+        csv.Field("mulai");
+        csv.Field("sampai");
+        csv.Field("hari");
+        csv.Field("jumlah");
+        csv.EndRow();
+        for (const InvoiceLine& line : run.lines) {
+            // ID aset, ID sub-aset, nama unit
+            const char* text = run.text.data() + line.textOffset;
+            for (int field = 0; field < 3; field++) {
+                size_t length = std::strlen(text);
+                csv.Field(text, length);
+                text += length + 1;
+            }
+            csv.Field(line.renterName.Utf8(), line.renterName.Length());
+            csv.Number(line.monthlyPrice);
+            csv.Date(line.startDay);
+            csv.Date(line.endDay - 1);      // tanggal terakhir yang ditagih
+            csv.Number(line.endDay - line.startDay);
+            csv.Number(line.amount);
+            csv.EndRow();
+        }
+
+        // Ringkasan per penyewa setelah baris kosong
+        csv.EndRow();
+        csv.Field("penyewa");
+        csv.Field("baris");
+        csv.Field("jumlah");
+        csv.EndRow();
+        for (const RenterTotal& total : run.renters) {
+            csv.Field(total.renterName.Utf8(), total.renterName.Length());
+            csv.Number(static_cast<long long>(total.lineCount));
+            csv.Number(total.amount);
+            csv.EndRow();
+        }
+        csv.Field("TOTAL");
+        csv.Number(static_cast<long long>(run.lines.size()));
+        csv.Number(run.totalAmount);
+        csv.EndRow();
+    }
+
+    bool ok = std::ferror(file) == 0;
+    return std::fclose(file) == 0 && ok;
+}
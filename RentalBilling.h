@@ -0,0 +1,50 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "AssetEngine.h"
+
+// Tagihan sewa bulanan dari rentalLedger. Setiap lease sub-aset yang beririsan
+// dengan bulan tagihan menjadi satu baris invoice; lease yang mulai atau
+// berakhir di tengah bulan diprorata per hari. Sub-aset semua tree dibagi
+// menjadi potongan preorder yang dikerjakan paralel, masing-masing ke buffer
+// sendiri, lalu digabung urut potongan: hasilnya sama berapa pun jumlah thread.
+// ID dan nama unit ikut disalin ke run, jadi file bisa ditulis setelah lock
+// registry dilepas.
+
+class WorkerPool;
+
+struct InvoiceLine {
+    EntityKey assetKey;
+    EntityKey subAssetKey;
+    InternedString renterName;
+    int monthlyPrice;
+    LedgerDay startDay;         // rentang yang ditagih [startDay, endDay)
+    LedgerDay endDay;
+    long long amount;           // monthlyPrice x hari tertagih / hari dalam bulan, dibulatkan
+    size_t textOffset;          // ID aset, ID sub-aset, nama unit di BillingRun::text (masing-masing diakhiri '\0')
+};
+
+struct RenterTotal {
+    InternedString renterName;
+    size_t lineCount;
+    long long amount;
+};
+
+struct BillingRun {
+    int year;
+    int month;                  // 1..12
+    int daysInMonth;
+    std::vector<InvoiceLine> lines;         // urut daftar tree, lalu preorder; lease lama dulu
+    std::vector<RenterTotal> renters;       // urut nama penyewa
+    std::string text;                       // teks per baris, lihat InvoiceLine::textOffset
+    size_t proratedLines;
+    long long totalAmount;
+    bool cancelled;
+};
+
+// Jalankan di bawah RegistryReadLock. pool = nullptr: semua potongan dikerjakan
+// di thread pemanggil.
+BillingRun RunMonthlyBilling(int year, int month, WorkerPool* pool = nullptr, TaskContext* context = nullptr);
+// CSV: baris invoice lalu total per penyewa; false jika file gagal ditulis.
+// Hanya membaca run (dan string intern), jadi tidak perlu lock registry.
+bool WriteBillingRun(const BillingRun& run, const std::string& path);
@@ -0,0 +1,144 @@
+#include "RentalLedger.h"
+#include <wx/datetime.h>
+#include <algorithm>
+
+// Konversi kalender Gregorian <-> nomor hari (algoritma days-from-civil)
+LedgerDay LedgerDayFromDate(int year, int month, int day) {
+    year -= month <= 2;
+    int era = (year >= 0 ? year : year - 399) / 400;
+    int yearOfEra = year - era * 400;
+    int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+void LedgerDateFromDay(LedgerDay day, int& year, int& month, int& dayOfMonth) {
+    day += 719468;
+    int era = (day >= 0 ? day : day - 146096) / 146097;
+    int dayOfEra = day - era * 146097;
+    int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int monthIndex = (5 * dayOfYear + 2) / 153;
+    dayOfMonth = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+    month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+    year = yearOfEra + era * 400 + (month <= 2);
+}
+
+LedgerDay LedgerToday() {
+    wxDateTime today = wxDateTime::Today();
+    return LedgerDayFromDate(today.GetYear(), static_cast<int>(today.GetMonth()) + 1, today.GetDay());
+}
+
+wxString FormatLedgerDay(LedgerDay day) {
+    if (day == LEASE_OPEN_END) return "-";
+    int year, month, dayOfMonth;
+    LedgerDateFromDay(day, year, month, dayOfMonth);
+    return wxString::Format("%02d/%02d/%04d", dayOfMonth, month, year);
+}
+
+bool RentalLedger::AddLease(EntityKey subAssetKey, LedgerDay start, LedgerDay end, int monthlyPrice,
+    const wxString& renterName) {
+    if (!AddLeaseUnindexed(subAssetKey, start, end, monthlyPrice, renterName)) return false;
+    if (pending.size() >= PENDING_LIMIT) RebuildIndex();
+    return true;
+}
+
+bool RentalLedger::AddLeaseUnindexed(EntityKey subAssetKey, LedgerDay start, LedgerDay end, int monthlyPrice,
+    const wxString& renterName) {
+    if (start >= end) return false;
+    // Riwayat satu unit pendek, jadi cek bentrok cukup menelusuri rantainya
+    for (LeaseId id = GetLatestLease(subAssetKey); id != NO_LEASE; id = leases[id].previousForUnit) {
+        if (leases[id].Overlaps(start, end)) return false;
+    }
+
+    LeaseId id = static_cast<LeaseId>(leases.size());
+    leases.push_back(Lease{ subAssetKey, start, end, monthlyPrice, InternedString(renterName),
+        GetLatestLease(subAssetKey) });
+    if (subAssetKey >= latestByUnit.size()) latestByUnit.resize(subAssetKey + 1, NO_LEASE);
+    latestByUnit[subAssetKey] = id;
+
+    pending.push_back(id);
+    return true;
+}
+
+bool RentalLedger::CloseOpenLease(EntityKey subAssetKey, LedgerDay day) {
+    for (LeaseId id = GetLatestLease(subAssetKey); id != NO_LEASE; id = leases[id].previousForUnit) {
+        Lease& lease = leases[id];
+        if (lease.endDay != LEASE_OPEN_END) continue;
+        // endDay hanya mengecil, jadi maxEnd di index tetap batas atas yang sah
+        lease.endDay = std::max(day, lease.startDay);
+        return true;
+    }
+    return false;
+}
+
+void RentalLedger::ReleaseUnit(EntityKey subAssetKey, LedgerDay day) {
+    CloseOpenLease(subAssetKey, day);
+    for (LeaseId id = GetLatestLease(subAssetKey); id != NO_LEASE; id = leases[id].previousForUnit) {
+        leases[id].subAssetKey = NO_ENTITY_KEY;
+    }
+    if (subAssetKey < latestByUnit.size()) latestByUnit[subAssetKey] = NO_LEASE;
+}
+
+std::vector<LeaseId> RentalLedger::FindOverlapping(LedgerDay start, LedgerDay end) const {
+    std::vector<LeaseId> result;
+    VisitOverlapping(start, end, [this, &result](const Lease& lease) {
+        result.push_back(static_cast<LeaseId>(&lease - leases.data()));
+        });
+    return result;
+}
+
+std::vector<LeaseId> RentalLedger::FindUnitOverlapping(EntityKey subAssetKey, LedgerDay start, LedgerDay end) const {
+    std::vector<LeaseId> result;
+    if (start >= end) return result;
+    for (LeaseId id = GetLatestLease(subAssetKey); id != NO_LEASE; id = leases[id].previousForUnit) {
+        if (leases[id].Overlaps(start, end)) result.push_back(id);
+    }
+    return result;
+}
+
+LedgerDay RentalLedger::buildMaxEnd(size_t lo, size_t hi) {
+    if (lo >= hi) return INT32_MIN;
+    size_t mid = lo + (hi - lo) / 2;
+    LedgerDay result = std::max(leases[sorted[mid]].endDay,
+        std::max(buildMaxEnd(lo, mid), buildMaxEnd(mid + 1, hi)));
+    maxEnd[mid] = result;
+    return result;
+}
+
+void RentalLedger::RebuildIndex() {
+    if (pending.empty()) return;
+    auto byStart = [this](LeaseId a, LeaseId b) { return leases[a].startDay < leases[b].startDay; };
+    // startDay tidak pernah berubah, jadi bagian yang sudah urut cukup digabung dengan ekor
+    std::sort(pending.begin(), pending.end(), byStart);
+    size_t indexed = sorted.size();
+    sorted.insert(sorted.end(), pending.begin(), pending.end());
+    std::inplace_merge(sorted.begin(), sorted.begin() + indexed, sorted.end(), byStart);
+    maxEnd.resize(sorted.size());
+    buildMaxEnd(0, sorted.size());
+    // Setelah muat massal ekor bisa sangat besar; kembalikan ke ukuran normal
+    if (pending.capacity() > PENDING_LIMIT) std::vector<LeaseId>().swap(pending);
+    else pending.clear();
+}
+
+size_t RentalLedger::GetOverheadBytes() const {
+    return (leases.capacity() - leases.size()) * sizeof(Lease) + latestByUnit.capacity() * sizeof(LeaseId) +
+        sorted.capacity() * sizeof(LeaseId) + maxEnd.capacity() * sizeof(LedgerDay) +
+        pending.capacity() * sizeof(LeaseId);
+}
+
+void RentalLedger::clear() {
+    std::vector<Lease>().swap(leases);
+    std::vector<LeaseId>().swap(latestByUnit);
+    std::vector<LeaseId>().swap(sorted);
+    std::vector<LedgerDay>().swap(maxEnd);
+    std::vector<LeaseId>().swap(pending);
+}
+
+void RentalLedger::swap(RentalLedger& other) {
+    leases.swap(other.leases);
+    latestByUnit.swap(other.latestByUnit);
+    sorted.swap(other.sorted);
+    maxEnd.swap(other.maxEnd);
+    pending.swap(other.pending);
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include <wx/string.h>
+#include <cstdint>
+#include <vector>
+#include "EntityKeys.h"
+#include "StringPool.h"
+
+// Ledger sewa: riwayat masa sewa (lease) setiap sub-aset. Tanggal disimpan
+// sebagai nomor hari sejak 1970-01-01; lease mencakup [startDay, endDay) dan
+// endDay = LEASE_OPEN_END selama sewa masih berjalan. Lease milik satu unit
+// tidak pernah beririsan.
+//
+// Query rentang tanggal memakai interval tree implisit: lease terindeks
+// diurutkan per startDay dan setiap sub-rentang menyimpan endDay maksimum,
+// jadi lease yang beririsan dengan [A, B) ditemukan dalam O(log n + k).
+// Lease baru masuk ke ekor kecil yang belum terindeks (ditelusuri linear);
+// saat ekor penuh index dibangun ulang oleh penulis. Diubah hanya di bawah
+// write lock DATA_SUB_ASET, pembaca tidak pernah mengubah index.
+
+typedef int32_t LedgerDay;
+typedef uint32_t LeaseId;
+const LedgerDay LEASE_OPEN_END = INT32_MAX;
+const LeaseId NO_LEASE = 0xFFFFFFFFu;
+
+// month 1..12
+LedgerDay LedgerDayFromDate(int year, int month, int day);
+void LedgerDateFromDay(LedgerDay day, int& year, int& month, int& dayOfMonth);
+LedgerDay LedgerToday();
+// "dd/mm/yyyy", format tanggal yang dipakai di seluruh aplikasi; "-" untuk LEASE_OPEN_END
+wxString FormatLedgerDay(LedgerDay day);
+
+struct Lease {
+    EntityKey subAssetKey;      // NO_ENTITY_KEY setelah unitnya dihapus
+    LedgerDay startDay;
+    LedgerDay endDay;           // eksklusif
+    int monthlyPrice;
+    InternedString renterName;
+    LeaseId previousForUnit;    // lease unit yang sama yang ditambahkan sebelumnya
+
+    // [start, end) tidak boleh kosong; lease yang ditutup di hari mulainya
+    // kosong dan tidak pernah beririsan
+    bool Overlaps(LedgerDay start, LedgerDay end) const {
+        return startDay < end && start < endDay && startDay < endDay;
+    }
+};
+
+class RentalLedger {
+public:
+    RentalLedger() {}
+
+    // false (tidak ditambahkan) jika rentang kosong atau beririsan dengan lease lain milik unit ini
+    bool AddLease(EntityKey subAssetKey, LedgerDay start, LedgerDay end, int monthlyPrice,
+        const wxString& renterName);
+    // Sama seperti AddLease tanpa membangun ulang index saat ekor penuh, untuk
+    // memuat banyak lease sekaligus; panggil RebuildIndex setelahnya
+    bool AddLeaseUnindexed(EntityKey subAssetKey, LedgerDay start, LedgerDay end, int monthlyPrice,
+        const wxString& renterName);
+    // Akhiri lease unit yang masih berjalan pada hari ini; false jika tidak ada
+    bool CloseOpenLease(EntityKey subAssetKey, LedgerDay day);
+    // Unit dihapus: lease berjalan diakhiri pada day, lalu riwayatnya dilepas dari
+    // key (subAssetKey = NO_ENTITY_KEY). ID sub-aset bisa dipakai ulang dan
+    // mendapat key yang sama; unit baru itu mulai tanpa riwayat sewa.
+    void ReleaseUnit(EntityKey subAssetKey, LedgerDay day);
+
+    const Lease& Get(LeaseId id) const { return leases[id]; }
+    size_t size() const { return leases.size(); }
+    // Lease terakhir yang ditambahkan untuk unit ini; ikuti previousForUnit untuk riwayatnya
+    LeaseId GetLatestLease(EntityKey subAssetKey) const {
+        return subAssetKey < latestByUnit.size() ? latestByUnit[subAssetKey] : NO_LEASE;
+    }
+
+    // Semua lease yang beririsan dengan [start, end), urutan tidak ditentukan
+    template <typename Visit>
+    void VisitOverlapping(LedgerDay start, LedgerDay end, Visit visit) const {
+        if (start >= end) return;
+        visitIndexed(0, sorted.size(), start, end, visit);
+        for (LeaseId id : pending) {
+            if (leases[id].Overlaps(start, end)) visit(leases[id]);
+        }
+    }
+    std::vector<LeaseId> FindOverlapping(LedgerDay start, LedgerDay end) const;
+    // Lease unit ini yang beririsan dengan [start, end) (cek bentrok sebelum menambah)
+    std::vector<LeaseId> FindUnitOverlapping(EntityKey subAssetKey, LedgerDay start, LedgerDay end) const;
+
+    // Masukkan ekor ke index sekarang, mis. setelah memuat banyak lease
+    void RebuildIndex();
+
+    size_t GetPayloadBytes() const { return leases.size() * sizeof(Lease); }
+    size_t GetOverheadBytes() const;
+
+    void clear();
+    void swap(RentalLedger& other);
+
+private:
+    static const size_t PENDING_LIMIT = 4096;
+
+    // Node implisit rentang [lo, hi) ada di tengahnya; maxEnd[mid] = endDay terbesar di rentang itu
+    template <typename Visit>
+    void visitIndexed(size_t lo, size_t hi, LedgerDay start, LedgerDay end, Visit& visit) const {
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (maxEnd[mid] <= start) return;
+            visitIndexed(lo, mid, start, end, visit);
+            const Lease& lease = leases[sorted[mid]];
+            // Lease di kanan tidak mulai lebih awal dari lease tengah
+            if (lease.startDay >= end) return;
+            if (lease.Overlaps(start, end)) visit(lease);
+            lo = mid + 1;
+        }
+    }
+    LedgerDay buildMaxEnd(size_t lo, size_t hi);
+
+    std::vector<Lease> leases;              // index = LeaseId
+    std::vector<LeaseId> latestByUnit;      // index = key sub-aset
+    std::vector<LeaseId> sorted;            // lease terindeks, urut startDay
+    std::vector<LedgerDay> maxEnd;          // sejajar sorted
+    std::vector<LeaseId> pending;           // belum terindeks
+};
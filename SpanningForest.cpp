@@ -0,0 +1,91 @@
+#include "SpanningForest.h"
+#include "PerfMetrics.h"
+#include "WorkerPool.h"
+#include <algorithm>
+
+namespace {
+    uint64_t pairKey(EntityKey a, EntityKey b) {
+        if (a > b) std::swap(a, b);
+        return (static_cast<uint64_t>(a) << 32) | b;
+    }
+}
+
+bool SpanningForest::Contains(EntityKey a, EntityKey b) const {
+    return std::binary_search(edgeKeys.begin(), edgeKeys.end(), pairKey(a, b));
+}
+
+SpanningForest ComputeMinimumSpanningForest(TaskContext* context) {
+    PERF_SCOPE("ComputeMinimumSpanningForest");
+    SpanningForest forest;
+    forest.totalWeight = 0;
+    forest.assetCount = 0;
+    forest.treeCount = 0;
+    forest.consideredEdges = 0;
+    forest.dataStamp = GetDataStamp(DATA_ASET | DATA_KONEKSI);
+    forest.cancelled = false;
+
+    std::vector<bool> alive(assetKeys.size(), false);
+    for (const auto& aset : daftarAset) {
+        alive[aset.key] = true;
+        forest.assetCount++;
+    }
+
+    // Key urut = bobot (digeser ke unsigned) lalu posisi koneksi di array;
+    // bobot sama diputus oleh urutan daftar, jadi hasilnya deterministik
+    std::vector<const AssetConnection*> connections;
+    connections.reserve(daftarKoneksiAset.size());
+    std::vector<uint64_t> order;
+    order.reserve(daftarKoneksiAset.size());
+    size_t index = 0;
+    for (const AssetConnection& connection : daftarKoneksiAset.view()) {
+        if (context && (++index % TASK_CHECK_INTERVAL) == 0 && context->IsCancelled()) {
+            forest.cancelled = true;
+            return forest;
+        }
+        EntityKey from = connection.fromAssetKey;
+        EntityKey to = connection.toAssetKey;
+        if (from >= alive.size() || to >= alive.size() || !alive[from] || !alive[to]) continue;
+        uint32_t weightKey = static_cast<uint32_t>(connection.weight) ^ 0x80000000u;
+        order.push_back((static_cast<uint64_t>(weightKey) << 32) | connections.size());
+        connections.push_back(&connection);
+    }
+    forest.consideredEdges = connections.size();
+    if (context) context->ReportProgress(10);
+
+    std::sort(order.begin(), order.end());
+    if (context) {
+        if (context->IsCancelled()) {
+            forest.cancelled = true;
+            return forest;
+        }
+        context->ReportProgress(50);
+    }
+
+    // Forest lengkap setelah assetCount - 1 koneksi; sisanya tidak perlu dilihat
+    DisjointSet sets;
+    sets.grow(assetKeys.size());
+    size_t target = forest.assetCount > 0 ? forest.assetCount - 1 : 0;
+    index = 0;
+    for (uint64_t key : order) {
+        if (forest.edges.size() >= target) break;
+        if (context && (++index % TASK_CHECK_INTERVAL) == 0) {
+            if (context->IsCancelled()) {
+                forest.cancelled = true;
+                return forest;
+            }
+            context->ReportProgress(50 + static_cast<int>(index * 50 / order.size()));
+        }
+        const AssetConnection& connection = *connections[static_cast<uint32_t>(key)];
+        if (!sets.unite(connection.fromAssetKey, connection.toAssetKey)) continue;
+        forest.edges.push_back(SpanningEdge{ connection.fromAssetKey, connection.toAssetKey, connection.weight });
+        forest.totalWeight += connection.weight;
+    }
+    forest.treeCount = forest.assetCount - forest.edges.size();
+
+    forest.edgeKeys.reserve(forest.edges.size());
+    for (const SpanningEdge& edge : forest.edges) {
+        forest.edgeKeys.push_back(pairKey(edge.fromAssetKey, edge.toAssetKey));
+    }
+    std::sort(forest.edgeKeys.begin(), forest.edgeKeys.end());
+    return forest;
+}
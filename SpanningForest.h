@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "AssetEngine.h"
+
+// Jaringan minimum: minimum spanning forest atas daftarKoneksiAset dengan
+// bobot koneksi sebagai biaya (kabel, pipa) antar lokasi. Kruskal: koneksi
+// diurutkan sekali sebagai array key 64-bit (bobot, urutan di daftar), lalu
+// diambil dari yang termurah selama menyambung dua komponen berbeda
+// (DisjointSet). O(E log E), cukup untuk jutaan koneksi di worker thread.
+// Koneksi ke aset yang sudah dihapus dilewati, seperti di graph.
+
+struct SpanningEdge {
+    EntityKey fromAssetKey;
+    EntityKey toAssetKey;
+    int weight;
+};
+
+struct SpanningForest {
+    std::vector<SpanningEdge> edges;        // koneksi terpilih, urut bobot naik
+    std::vector<uint64_t> edgeKeys;         // pasangan (key kecil, key besar) dari edges, terurut; untuk Contains
+    long long totalWeight;
+    size_t assetCount;                      // aset yang masih ada
+    size_t treeCount;                       // komponen, termasuk aset tanpa koneksi
+    size_t consideredEdges;                 // koneksi antar aset yang masih ada
+    unsigned long dataStamp;                // GetDataStamp(DATA_ASET | DATA_KONEKSI) saat dihitung
+    bool cancelled;
+
+    // Koneksi a-b (arah mana pun) termasuk jaringan; O(log n)
+    bool Contains(EntityKey a, EntityKey b) const;
+};
+
+// Jalankan di bawah RegistryReadLock
+SpanningForest ComputeMinimumSpanningForest(TaskContext* context = nullptr);
@@ -0,0 +1,204 @@
+#include "StringPool.h"
+#include <algorithm>
+#include <cctype>
+#include <mutex>
+
+StringInterner stringInterner;
+
+uint32_t HashUtf8(const char* utf8, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= static_cast<unsigned char>(utf8[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool Utf8Equals(const char* utf8, size_t length, const wxString& text) {
+    // Setiap karakter minimal satu byte UTF-8
+    if (length < text.length()) return false;
+    if (length == text.length()) {
+        size_t i = 0;
+        for (wxString::const_iterator it = text.begin(); it != text.end(); ++it, ++i) {
+            wxUniChar ch = *it;
+            if (!ch.IsAscii()) return wxString::FromUTF8(utf8, length) == text;
+            if (static_cast<unsigned char>(utf8[i]) != ch.GetValue()) return false;
+        }
+        return true;
+    }
+    return wxString::FromUTF8(utf8, length) == text;
+}
+
+bool Utf8EqualsNoCase(const char* utf8, size_t length, const wxString& text) {
+    if (length < text.length()) return false;
+    if (length == text.length()) {
+        size_t i = 0;
+        for (wxString::const_iterator it = text.begin(); it != text.end(); ++it, ++i) {
+            wxUniChar ch = *it;
+            unsigned char byte = static_cast<unsigned char>(utf8[i]);
+            if (!ch.IsAscii() || byte >= 0x80) {
+                return wxString::FromUTF8(utf8, length).IsSameAs(text, false);
+            }
+            if (std::tolower(byte) != std::tolower(static_cast<int>(ch.GetValue()))) return false;
+        }
+        return true;
+    }
+    return wxString::FromUTF8(utf8, length).IsSameAs(text, false);
+}
+
+// COMPACT STRING
+
+void CompactString::Assign(const wxString& text) {
+    wxScopedCharBuffer utf8 = text.utf8_str();
+    Assign(utf8.data(), utf8.length());
+}
+
+void CompactString::Assign(const char* utf8, size_t length) {
+    char* block = nullptr;
+    if (length > 0) {
+        uint32_t stored = static_cast<uint32_t>(length);
+        block = new char[sizeof(uint32_t) + length + 1];
+        std::memcpy(block, &stored, sizeof(stored));
+        std::memcpy(block + sizeof(uint32_t), utf8, length);
+        block[sizeof(uint32_t) + length] = '\0';
+    }
+    delete[] data;
+    data = block;
+}
+
+// STRING INTERNER
+
+StringInterner::StringInterner() : count(0), arenaUsed(0), arenaBytes(0) {
+    for (size_t i = 0; i < INTERN_MAX_CHUNKS; i++) {
+        chunks[i].store(nullptr, std::memory_order_relaxed);
+    }
+    slots.assign(1024, 0);
+
+    // Handle 0 = string kosong; tidak masuk tabel hash
+    static const char emptyEntry[sizeof(uint32_t) + 1] = {};
+    const char** chunk = new const char*[INTERN_CHUNK_SIZE];
+    chunk[0] = emptyEntry;
+    chunks[0].store(chunk, std::memory_order_release);
+    count = 1;
+}
+
+StringInterner::~StringInterner() {
+    for (size_t i = 0; i < INTERN_MAX_CHUNKS; i++) {
+        delete[] chunks[i].load(std::memory_order_relaxed);
+    }
+    for (char* block : arenaBlocks) {
+        delete[] block;
+    }
+}
+
+// Cari slot berisi string ini, atau slot kosong tempat menyisipkannya
+bool StringInterner::FindLocked(const char* utf8, size_t length, uint32_t hash, size_t& slot) const {
+    size_t mask = slots.size() - 1;
+    slot = hash & mask;
+    while (slots[slot] != 0) {
+        StringHandle handle = slots[slot];
+        if (GetLength(handle) == length && std::memcmp(GetUtf8(handle), utf8, length) == 0) {
+            return true;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return false;
+}
+
+// Gandakan tabel hash saat terisi lebih dari separuh
+void StringInterner::Grow() {
+    std::vector<uint32_t> grown(slots.size() * 2, 0);
+    size_t mask = grown.size() - 1;
+    for (uint32_t handle : slots) {
+        if (handle == 0) continue;
+        size_t slot = HashUtf8(GetUtf8(handle), GetLength(handle)) & mask;
+        while (grown[slot] != 0) slot = (slot + 1) & mask;
+        grown[slot] = handle;
+    }
+    slots.swap(grown);
+}
+
+StringHandle StringInterner::Intern(const wxString& text) {
+    if (text.empty()) return EMPTY_STRING_HANDLE;
+    wxScopedCharBuffer utf8 = text.utf8_str();
+    return Intern(utf8.data(), utf8.length());
+}
+
+StringHandle StringInterner::Intern(const char* utf8, size_t length) {
+    if (length == 0) return EMPTY_STRING_HANDLE;
+    uint32_t hash = HashUtf8(utf8, length);
+    size_t slot;
+
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        if (FindLocked(utf8, length, hash, slot)) return slots[slot];
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    // Thread lain mungkin sudah menyisipkan string yang sama
+    if (FindLocked(utf8, length, hash, slot)) return slots[slot];
+    if (count == INTERN_MAX_CHUNKS * INTERN_CHUNK_SIZE) return EMPTY_STRING_HANDLE;
+
+    // Salin teks ke arena
+    size_t entrySize = sizeof(uint32_t) + length + 1;
+    if (arenaBlocks.empty() || arenaUsed + entrySize > INTERN_ARENA_BLOCK) {
+        size_t blockSize = std::max<size_t>(INTERN_ARENA_BLOCK, entrySize);
+        arenaBlocks.push_back(new char[blockSize]);
+        arenaBytes += blockSize;
+        arenaUsed = 0;
+    }
+    char* entry = arenaBlocks.back() + arenaUsed;
+    arenaUsed += entrySize;
+    uint32_t stored = static_cast<uint32_t>(length);
+    std::memcpy(entry, &stored, sizeof(stored));
+    std::memcpy(entry + sizeof(uint32_t), utf8, length);
+    entry[sizeof(uint32_t) + length] = '\0';
+
+    // Entry ditulis sebelum handle dikembalikan; pembaca lain mendapat handle
+    // lewat registry lock / antrean task, jadi Get() tidak perlu lock
+    StringHandle handle = static_cast<StringHandle>(count);
+    const char** chunk = chunks[handle >> INTERN_CHUNK_BITS].load(std::memory_order_relaxed);
+    if (!chunk) {
+        chunk = new const char*[INTERN_CHUNK_SIZE];
+        chunks[handle >> INTERN_CHUNK_BITS].store(chunk, std::memory_order_release);
+    }
+    chunk[handle & (INTERN_CHUNK_SIZE - 1)] = entry;
+    count++;
+
+    slots[slot] = handle;
+    if ((count - 1) * 2 > slots.size()) Grow();
+    return handle;
+}
+
+bool StringInterner::Find(const wxString& text, StringHandle& handle) const {
+    if (text.empty()) {
+        handle = EMPTY_STRING_HANDLE;
+        return true;
+    }
+    wxScopedCharBuffer utf8 = text.utf8_str();
+    return Find(utf8.data(), utf8.length(), handle);
+}
+
+bool StringInterner::Find(const char* utf8, size_t length, StringHandle& handle) const {
+    if (length == 0) {
+        handle = EMPTY_STRING_HANDLE;
+        return true;
+    }
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    size_t slot;
+    if (!FindLocked(utf8, length, HashUtf8(utf8, length), slot)) return false;
+    handle = slots[slot];
+    return true;
+}
+
+size_t StringInterner::GetCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return count;
+}
+
+size_t StringInterner::GetMemoryBytes() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    size_t chunkCount = (count + INTERN_CHUNK_SIZE - 1) / INTERN_CHUNK_SIZE;
+    return arenaBytes + chunkCount * INTERN_CHUNK_SIZE * sizeof(const char*) +
+        slots.size() * sizeof(uint32_t);
+}
@@ -0,0 +1,181 @@
+#pragma once
+#include <wx/string.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <shared_mutex>
+#include <string_view>
+#include <vector>
+
+// Penyimpanan string record yang hemat memori.
+//
+// CompactString: teks bebas (id, nama, deskripsi) sebagai UTF-8 dalam satu
+// alokasi [panjang][byte][0]; objeknya hanya satu pointer, kosong = nullptr.
+//
+// InternedString: nilai yang berulang di banyak record (kategori, status,
+// parentId, nama penyewa, ...) disimpan sekali di StringInterner dan record
+// hanya memegang handle 32-bit, sehingga perbandingan sama dengan compare
+// integer.
+//
+// Keduanya bisa dikonversi implisit ke wxString, jadi kode tampilan tetap
+// membaca field record seperti biasa. Konversi itu membuat wxString baru;
+// di loop panas pakai Utf8()/Length()/GetHandle() langsung.
+
+typedef uint32_t StringHandle;
+
+// Handle 0 selalu string kosong
+const StringHandle EMPTY_STRING_HANDLE = 0;
+
+// FNV-1a 32-bit
+uint32_t HashUtf8(const char* utf8, size_t length);
+
+// Bandingkan UTF-8 dengan wxString; teks ASCII dibandingkan langsung tanpa alokasi
+bool Utf8Equals(const char* utf8, size_t length, const wxString& text);
+// Seperti IsSameAs(text, false)
+bool Utf8EqualsNoCase(const char* utf8, size_t length, const wxString& text);
+
+class CompactString {
+public:
+    CompactString() : data(nullptr) {}
+    explicit CompactString(const wxString& text) : data(nullptr) { Assign(text); }
+    CompactString(const char* utf8, size_t length) : data(nullptr) { Assign(utf8, length); }
+    CompactString(const CompactString& other) : data(nullptr) { Assign(other.Utf8(), other.Length()); }
+    CompactString(CompactString&& other) noexcept : data(other.data) { other.data = nullptr; }
+    ~CompactString() { delete[] data; }
+
+    CompactString& operator=(const CompactString& other) {
+        if (this != &other) Assign(other.Utf8(), other.Length());
+        return *this;
+    }
+    CompactString& operator=(CompactString&& other) noexcept {
+        if (this != &other) {
+            delete[] data;
+            data = other.data;
+            other.data = nullptr;
+        }
+        return *this;
+    }
+    CompactString& operator=(const wxString& text) { Assign(text); return *this; }
+
+    // Panjang dalam byte UTF-8 (bukan karakter)
+    size_t Length() const {
+        if (!data) return 0;
+        uint32_t length;
+        std::memcpy(&length, data, sizeof(length));
+        return length;
+    }
+    bool IsEmpty() const { return data == nullptr; }
+    const char* Utf8() const { return data ? data + sizeof(uint32_t) : ""; }
+    // Kunci hash tanpa salinan; valid selama string ini tidak diubah
+    std::string_view View() const { return std::string_view(Utf8(), Length()); }
+
+    wxString ToWxString() const { return data ? wxString::FromUTF8(Utf8(), Length()) : wxString(); }
+    operator wxString() const { return ToWxString(); }
+
+    bool StartsWith(const char* prefix, size_t length) const {
+        return Length() >= length && std::memcmp(Utf8(), prefix, length) == 0;
+    }
+
+    // Ukuran blok heap (tanpa header malloc)
+    size_t HeapBytes() const { return data ? sizeof(uint32_t) + Length() + 1 : 0; }
+
+    bool operator==(const CompactString& other) const {
+        return Length() == other.Length() && std::memcmp(Utf8(), other.Utf8(), Length()) == 0;
+    }
+    bool operator!=(const CompactString& other) const { return !(*this == other); }
+    bool operator==(const wxString& text) const { return Utf8Equals(Utf8(), Length(), text); }
+    bool operator!=(const wxString& text) const { return !(*this == text); }
+
+private:
+    void Assign(const wxString& text);
+    void Assign(const char* utf8, size_t length);
+
+    char* data;
+};
+
+// Tabel string global, append-only: string yang sudah diintern tidak pernah
+// dibebaskan, jadi handle tetap valid selama program berjalan.
+// Get() tanpa lock (aman dari worker); Intern/Find memakai lock internal.
+class StringInterner {
+public:
+    StringInterner();
+    ~StringInterner();
+
+    StringHandle Intern(const wxString& text);
+    StringHandle Intern(const char* utf8, size_t length);
+
+    // false jika string belum pernah diintern (tidak ada record yang memakainya)
+    bool Find(const wxString& text, StringHandle& handle) const;
+    bool Find(const char* utf8, size_t length, StringHandle& handle) const;
+
+    const char* GetUtf8(StringHandle handle) const {
+        const char* entry = chunks[handle >> INTERN_CHUNK_BITS].load(std::memory_order_acquire)
+            [handle & (INTERN_CHUNK_SIZE - 1)];
+        return entry + sizeof(uint32_t);
+    }
+    size_t GetLength(StringHandle handle) const {
+        const char* entry = chunks[handle >> INTERN_CHUNK_BITS].load(std::memory_order_acquire)
+            [handle & (INTERN_CHUNK_SIZE - 1)];
+        uint32_t length;
+        std::memcpy(&length, entry, sizeof(length));
+        return length;
+    }
+    wxString Get(StringHandle handle) const {
+        return handle == EMPTY_STRING_HANDLE ? wxString() : wxString::FromUTF8(GetUtf8(handle), GetLength(handle));
+    }
+
+    size_t GetCount() const;
+    // Arena teks + tabel entry + tabel hash
+    size_t GetMemoryBytes() const;
+
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+private:
+    static const size_t INTERN_CHUNK_BITS = 12;
+    static const size_t INTERN_CHUNK_SIZE = size_t(1) << INTERN_CHUNK_BITS;
+    static const size_t INTERN_MAX_CHUNKS = size_t(1) << 16;
+    static constexpr size_t INTERN_ARENA_BLOCK = 64 * 1024;
+
+    bool FindLocked(const char* utf8, size_t length, uint32_t hash, size_t& slot) const;
+    void Grow();
+
+    mutable std::shared_mutex mutex;
+    std::atomic<const char**> chunks[INTERN_MAX_CHUNKS];   // handle -> entry [panjang][byte][0]
+    size_t count;
+    std::vector<uint32_t> slots;        // open addressing, isi handle; 0 = kosong
+    std::vector<char*> arenaBlocks;
+    size_t arenaUsed;                   // byte terpakai di blok terakhir
+    size_t arenaBytes;                  // total byte semua blok
+};
+
+extern StringInterner stringInterner;
+
+class InternedString {
+public:
+    InternedString() : handle(EMPTY_STRING_HANDLE) {}
+    explicit InternedString(const wxString& text) : handle(stringInterner.Intern(text)) {}
+    explicit InternedString(StringHandle handle) : handle(handle) {}
+
+    InternedString& operator=(const wxString& text) {
+        handle = stringInterner.Intern(text);
+        return *this;
+    }
+
+    StringHandle GetHandle() const { return handle; }
+    bool IsEmpty() const { return handle == EMPTY_STRING_HANDLE; }
+    const char* Utf8() const { return handle == EMPTY_STRING_HANDLE ? "" : stringInterner.GetUtf8(handle); }
+    size_t Length() const { return handle == EMPTY_STRING_HANDLE ? 0 : stringInterner.GetLength(handle); }
+
+    wxString ToWxString() const { return stringInterner.Get(handle); }
+    operator wxString() const { return ToWxString(); }
+
+    bool operator==(const InternedString& other) const { return handle == other.handle; }
+    bool operator!=(const InternedString& other) const { return handle != other.handle; }
+    bool operator==(const wxString& text) const { return Utf8Equals(Utf8(), Length(), text); }
+    bool operator!=(const wxString& text) const { return !(*this == text); }
+
+private:
+    StringHandle handle;
+};
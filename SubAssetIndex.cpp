@@ -0,0 +1,141 @@
+#include "SubAssetIndex.h"
+#include "AssetEngine.h"
+
+// Vector index diperbesar seperlunya saat key baru muncul
+template <typename V>
+static void setAt(std::vector<V>& index, EntityKey key, V value) {
+    if (key >= index.size()) index.resize(key + 1, V());
+    index[key] = value;
+}
+
+void SubAssetIndex::AttachTree(AssetTree<SubAssetHandle>* tree) {
+    TreeNode<SubAssetHandle>* root = tree->getRoot();
+    if (!root) return;
+    // Satu tree per aset; jika ada duplikat, yang pertama yang dipakai
+    EntityKey assetKey = pool.get(root->data).parentKey;
+    if (!FindTree(assetKey)) setAt(trees, assetKey, tree);
+
+    ArrayView<TreeNode<SubAssetHandle>*> nodes = tree->getSubtree(root);
+    for (TreeNode<SubAssetHandle>* node : nodes) {
+        EntityKey key = pool.get(node->data).key;
+        setAt(treeNodes, key, node);
+        setAt(rollups, key, SubAssetRollup{ 0, 0, 0 });
+    }
+    // Urutan preorder mundur: rollup anak sudah lengkap sebelum ditambahkan ke parent
+    for (size_t i = nodes.size(); i-- > 1;) {
+        SubAssetRollup add = contribution(nodes[i]);
+        SubAssetRollup& parent = rollups[pool.get(nodes[i]->parent->data).key];
+        parent.units += add.units;
+        parent.rented += add.rented;
+        parent.income += add.income;
+    }
+}
+
+void SubAssetIndex::DetachTree(AssetTree<SubAssetHandle>* tree) {
+    TreeNode<SubAssetHandle>* root = tree->getRoot();
+    if (!root) return;
+    EntityKey assetKey = pool.get(root->data).parentKey;
+    if (FindTree(assetKey) == tree) trees[assetKey] = nullptr;
+    DetachSubtree(root);
+}
+
+void SubAssetIndex::AttachTreeNode(TreeNode<SubAssetHandle>* node) {
+    EntityKey key = pool.get(node->data).key;
+    setAt(treeNodes, key, node);
+    setAt(rollups, key, SubAssetRollup{ 0, 0, 0 });
+    AddToAncestors(node);
+}
+
+void SubAssetIndex::DetachSubtree(TreeNode<SubAssetHandle>* node) {
+    RemoveFromAncestors(node);
+    AssetTree<SubAssetHandle>::walk(node, [this](TreeNode<SubAssetHandle>* current, int) {
+        EntityKey key = pool.get(current->data).key;
+        if (FindTreeNode(key) == current) {
+            treeNodes[key] = nullptr;
+            rollups[key] = SubAssetRollup{ 0, 0, 0 };
+        }
+        });
+}
+
+void SubAssetIndex::RelocateTreeNode(TreeNode<SubAssetHandle>* node) {
+    setAt(treeNodes, pool.get(node->data).key, node);
+}
+
+// Sumbangan subtree node ke setiap ancestor: node itu sendiri + turunannya
+SubAssetRollup SubAssetIndex::contribution(TreeNode<SubAssetHandle>* node) const {
+    const SubAsset& subAsset = pool.get(node->data);
+    SubAssetRollup add = GetRollup(subAsset.key);
+    add.units++;
+    if (subAsset.isRented) {
+        add.rented++;
+        add.income += subAsset.rentalPrice;
+    }
+    return add;
+}
+
+void SubAssetIndex::RemoveFromAncestors(TreeNode<SubAssetHandle>* node) {
+    SubAssetRollup removed = contribution(node);
+    for (TreeNode<SubAssetHandle>* ancestor = node->parent; ancestor; ancestor = ancestor->parent) {
+        SubAssetRollup& rollup = rollups[pool.get(ancestor->data).key];
+        rollup.units -= removed.units;
+        rollup.rented -= removed.rented;
+        rollup.income -= removed.income;
+    }
+}
+
+void SubAssetIndex::AddToAncestors(TreeNode<SubAssetHandle>* node) {
+    SubAssetRollup added = contribution(node);
+    for (TreeNode<SubAssetHandle>* ancestor = node->parent; ancestor; ancestor = ancestor->parent) {
+        SubAssetRollup& rollup = rollups[pool.get(ancestor->data).key];
+        rollup.units += added.units;
+        rollup.rented += added.rented;
+        rollup.income += added.income;
+    }
+}
+
+void SubAssetIndex::AttachListNode(Node<SubAssetHandle>* node) {
+    const SubAsset& subAsset = pool.get(node->data);
+    setAt(listNodes, subAsset.key, node);
+    EntityKey parent = subAsset.parentKey;
+    setAt(subAssetCounts, parent, static_cast<uint32_t>(GetSubAssetCount(parent) + 1));
+}
+
+void SubAssetIndex::DetachListNode(Node<SubAssetHandle>* node) {
+    const SubAsset& subAsset = pool.get(node->data);
+    if (FindListNode(subAsset.key) == node) listNodes[subAsset.key] = nullptr;
+    if (subAsset.parentKey < subAssetCounts.size() && subAssetCounts[subAsset.parentKey] > 0) {
+        subAssetCounts[subAsset.parentKey]--;
+    }
+}
+
+void SubAssetIndex::Rebuild(const LinkedList<AssetTree<SubAssetHandle>*>& assetTrees, const LinkedList<SubAssetHandle>& subAssets) {
+    clear();
+    for (Node<AssetTree<SubAssetHandle>*>* tree = assetTrees.getHead(); tree; tree = tree->next) {
+        AttachTree(tree->data);
+    }
+    for (Node<SubAssetHandle>* node = subAssets.getHead(); node; node = node->next) {
+        AttachListNode(node);
+    }
+}
+
+size_t SubAssetIndex::GetOverheadBytes() const {
+    return treeNodes.capacity() * sizeof(TreeNode<SubAssetHandle>*) + listNodes.capacity() * sizeof(Node<SubAssetHandle>*) +
+        trees.capacity() * sizeof(AssetTree<SubAssetHandle>*) + subAssetCounts.capacity() * sizeof(uint32_t) +
+        rollups.capacity() * sizeof(SubAssetRollup);
+}
+
+void SubAssetIndex::clear() {
+    std::vector<TreeNode<SubAssetHandle>*>().swap(treeNodes);
+    std::vector<Node<SubAssetHandle>*>().swap(listNodes);
+    std::vector<AssetTree<SubAssetHandle>*>().swap(trees);
+    std::vector<uint32_t>().swap(subAssetCounts);
+    std::vector<SubAssetRollup>().swap(rollups);
+}
+
+void SubAssetIndex::swap(SubAssetIndex& other) {
+    treeNodes.swap(other.treeNodes);
+    listNodes.swap(other.listNodes);
+    trees.swap(other.trees);
+    subAssetCounts.swap(other.subAssetCounts);
+    rollups.swap(other.rollups);
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "DataStructures.h"
+#include "EntityKeys.h"
+
+// Index sub-aset: key sub-aset -> node tree dan node daftarSubAset, key aset
+// -> tree sub-asetnya. Key padat, jadi index cukup berupa vector yang
+// di-index key; cari, sisip dan hapus O(1) berapa pun jumlah tree dan node.
+// Hanya diubah di bawah write lock DATA_SUB_ASET, dibaca worker di bawah
+// RegistryReadLock.
+//
+// List dan tree hanya memegang handle; record-nya dibaca dari pool yang
+// diberikan saat konstruksi (pool ikut di-swap bersama index).
+//
+// Index juga menyimpan rollup sewa per node tree. Setiap perubahan (node
+// baru, subtree dihapus, status sewa diubah) hanya memperbarui rantai
+// ancestor node itu, O(depth).
+
+struct SubAsset;
+typedef PoolHandle SubAssetHandle;
+
+// Agregat turunan satu node tree (node itu sendiri tidak dihitung)
+struct SubAssetRollup {
+    uint32_t units;         // jumlah turunan
+    uint32_t rented;        // turunan yang sedang disewa
+    long long income;       // total rentalPrice turunan yang disewa
+};
+
+class SubAssetIndex {
+public:
+    explicit SubAssetIndex(const ObjectPool<SubAsset>& pool) : pool(pool) {}
+
+    TreeNode<SubAssetHandle>* FindTreeNode(EntityKey subAssetKey) const {
+        return subAssetKey < treeNodes.size() ? treeNodes[subAssetKey] : nullptr;
+    }
+    Node<SubAssetHandle>* FindListNode(EntityKey subAssetKey) const {
+        return subAssetKey < listNodes.size() ? listNodes[subAssetKey] : nullptr;
+    }
+    // Handle record sub-aset (termasuk root tree); NO_POOL_HANDLE jika tidak ada
+    SubAssetHandle FindHandle(EntityKey subAssetKey) const {
+        if (Node<SubAssetHandle>* node = FindListNode(subAssetKey)) return node->data;
+        if (TreeNode<SubAssetHandle>* node = FindTreeNode(subAssetKey)) return node->data;
+        return NO_POOL_HANDLE;
+    }
+    AssetTree<SubAssetHandle>* FindTree(EntityKey assetKey) const {
+        return assetKey < trees.size() ? trees[assetKey] : nullptr;
+    }
+    // Jumlah entri daftarSubAset milik aset ini
+    size_t GetSubAssetCount(EntityKey assetKey) const {
+        return assetKey < subAssetCounts.size() ? subAssetCounts[assetKey] : 0;
+    }
+
+    // Rollup node tree; nol jika key tidak ada di tree
+    SubAssetRollup GetRollup(EntityKey subAssetKey) const {
+        return subAssetKey < rollups.size() ? rollups[subAssetKey] : SubAssetRollup{ 0, 0, 0 };
+    }
+
+    // Tree didaftarkan per key aset (root.parentKey) beserta semua node-nya
+    void AttachTree(AssetTree<SubAssetHandle>* tree);
+    void DetachTree(AssetTree<SubAssetHandle>* tree);
+    // Node tree baru (tanpa anak) yang sudah disambung ke parent-nya /
+    // seluruh subtree sebelum dihapus (masih tersambung)
+    void AttachTreeNode(TreeNode<SubAssetHandle>* node);
+    void DetachSubtree(TreeNode<SubAssetHandle>* node);
+    // Node yang sama pindah alamat (subtree disalin ke tree lain); rollup tetap
+    void RelocateTreeNode(TreeNode<SubAssetHandle>* node);
+    // Kurangi / tambahkan sumbangan subtree node ke rollup ancestor-nya. Dipakai
+    // mengapit perubahan record (status sewa, harga) atau posisi node.
+    void RemoveFromAncestors(TreeNode<SubAssetHandle>* node);
+    void AddToAncestors(TreeNode<SubAssetHandle>* node);
+    // Node daftarSubAset
+    void AttachListNode(Node<SubAssetHandle>* node);
+    void DetachListNode(Node<SubAssetHandle>* node);
+
+    // Bangun ulang dari nol, mis. setelah data dimuat langsung ke list/tree
+    void Rebuild(const LinkedList<AssetTree<SubAssetHandle>*>& assetTrees, const LinkedList<SubAssetHandle>& subAssets);
+
+    size_t GetOverheadBytes() const;
+
+    void clear();
+    void swap(SubAssetIndex& other);
+
+private:
+    SubAssetRollup contribution(TreeNode<SubAssetHandle>* node) const;
+
+    const ObjectPool<SubAsset>& pool;
+    std::vector<TreeNode<SubAssetHandle>*> treeNodes;   // index = key sub-aset
+    std::vector<Node<SubAssetHandle>*> listNodes;       // index = key sub-aset
+    std::vector<AssetTree<SubAssetHandle>*> trees;      // index = key aset
+    std::vector<uint32_t> subAssetCounts;               // index = key aset
+    std::vector<SubAssetRollup> rollups;                // index = key sub-aset
+};
@@ -0,0 +1,129 @@
+#include "WorkerPool.h"
+#include <algorithm>
+
+void TaskContext::ReportProgress(int percent) {
+    if (!onProgress || IsCancelled()) return;
+
+    if (state->lastProgress.exchange(percent) == percent) return;
+
+    std::shared_ptr<TaskState> taskState = state;
+    std::function<void(int)> callback = onProgress;
+    owner->CallAfter([taskState, callback, percent]() {
+        if (!taskState->cancelled) {
+            callback(percent);
+        }
+    });
+}
+
+WorkerPool::WorkerPool(size_t threadCount) : stopping(false) {
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0) threadCount = 2;
+    }
+
+    for (size_t i = 0; i < threadCount; i++) {
+        workers.emplace_back(&WorkerPool::WorkerLoop, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    CancelAll();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+namespace {
+    // Indeks ParallelFor yang dibagi antara pemanggil dan helper di worker.
+    // Helper yang baru jalan setelah semua indeks diambil langsung selesai.
+    struct ParallelBatch {
+        std::function<void(size_t)> body;
+        size_t count;
+        std::atomic<size_t> next{ 0 };
+        std::atomic<size_t> finished{ 0 };
+        std::mutex mutex;
+        std::condition_variable allDone;
+
+        void Drain() {
+            size_t index;
+            while ((index = next.fetch_add(1)) < count) {
+                body(index);
+                if (finished.fetch_add(1) + 1 == count) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    allDone.notify_all();
+                }
+            }
+        }
+    };
+}
+
+void WorkerPool::ParallelFor(size_t count, std::function<void(size_t)> body) {
+    if (count == 0) return;
+    std::shared_ptr<ParallelBatch> batch = std::make_shared<ParallelBatch>();
+    batch->body = body;
+    batch->count = count;
+
+    size_t helpers = std::min(workers.size(), count - 1);
+    for (size_t i = 0; i < helpers; i++) {
+        Enqueue(std::make_shared<TaskState>(), [batch]() { batch->Drain(); });
+    }
+    batch->Drain();
+
+    std::unique_lock<std::mutex> lock(batch->mutex);
+    batch->allDone.wait(lock, [&batch]() { return batch->finished.load() == batch->count; });
+}
+
+void WorkerPool::CancelAll() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& job : jobs) {
+        job.state->cancelled = true;
+    }
+    jobs.clear();
+
+    for (auto& weak : running) {
+        std::shared_ptr<TaskState> state = weak.lock();
+        if (state) state->cancelled = true;
+    }
+}
+
+void WorkerPool::Enqueue(std::shared_ptr<TaskState> state, std::function<void()> run) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(Job{ state, run });
+    }
+    wakeUp.notify_one();
+}
+
+void WorkerPool::WorkerLoop() {
+    SetTraceThreadName("Worker");
+
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeUp.wait(lock, [this]() { return stopping || !jobs.empty(); });
+            if (stopping && jobs.empty()) return;
+
+            job = jobs.front();
+            jobs.pop_front();
+
+            // Buang entry task yang sudah selesai sebelum mendaftarkan yang baru
+            running.erase(std::remove_if(running.begin(), running.end(),
+                [](const std::weak_ptr<TaskState>& weak) { return weak.expired(); }),
+                running.end());
+            running.push_back(job.state);
+        }
+
+        {
+            TRACE_SCOPE("WorkerPool::task");
+            job.run();
+        }
+        job.state->done = true;
+    }
+}
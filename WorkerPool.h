@@ -0,0 +1,107 @@
+#pragma once
+#include "PerfTrace.h"
+#include <wx/event.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// State bersama antara TaskHandle (UI thread) dan job yang sedang jalan di worker
+struct TaskState {
+    std::atomic<bool> cancelled{ false };
+    std::atomic<bool> done{ false };
+    std::atomic<int> lastProgress{ -1 };
+};
+
+// Diberikan ke fungsi kerja; dipakai untuk cek pembatalan dan kirim progress
+class TaskContext {
+public:
+    TaskContext(wxEvtHandler* owner, std::shared_ptr<TaskState> state,
+        std::function<void(int)> onProgress)
+        : owner(owner), state(state), onProgress(onProgress) {
+    }
+
+    bool IsCancelled() const { return state->cancelled.load(std::memory_order_relaxed); }
+
+    // percent 0-100; hanya dikirim ke UI jika nilainya berubah
+    void ReportProgress(int percent);
+
+private:
+    wxEvtHandler* owner;
+    std::shared_ptr<TaskState> state;
+    std::function<void(int)> onProgress;
+};
+
+// Handle untuk task yang sudah di-submit; aman disalin dan disimpan di UI thread
+class TaskHandle {
+public:
+    TaskHandle() {}
+    explicit TaskHandle(std::shared_ptr<TaskState> state) : state(state) {}
+
+    void Cancel() { if (state) state->cancelled = true; }
+    bool IsRunning() const { return state && !state->done && !state->cancelled; }
+
+private:
+    std::shared_ptr<TaskState> state;
+};
+
+// Thread pool sederhana. Hasil dan progress dikirim balik ke UI thread lewat
+// CallAfter, dan callback tidak dipanggil lagi setelah task dibatalkan.
+class WorkerPool {
+public:
+    explicit WorkerPool(size_t threadCount = 0);
+    ~WorkerPool();
+
+    template <typename R>
+    TaskHandle Submit(wxEvtHandler* owner,
+        std::function<R(TaskContext&)> work,
+        std::function<void(R&)> onDone,
+        std::function<void(int)> onProgress = nullptr) {
+        std::shared_ptr<TaskState> state = std::make_shared<TaskState>();
+
+        Enqueue(state, [owner, state, work, onDone, onProgress]() {
+            if (state->cancelled) return;
+
+            TaskContext context(owner, state, onProgress);
+            std::shared_ptr<R> result = std::make_shared<R>(work(context));
+            if (state->cancelled || !onDone) return;
+
+            owner->CallAfter([state, result, onDone]() {
+                if (!state->cancelled) {
+                    TRACE_SCOPE("WorkerPool::onDone");
+                    onDone(*result);
+                }
+            });
+        });
+
+        return TaskHandle(state);
+    }
+
+    // Jalankan body(0) .. body(count - 1) di worker dan thread pemanggil, kembali
+    // setelah semuanya selesai. Pemanggil ikut mengambil indeks, jadi aman
+    // dipanggil dari dalam job pool ini walaupun semua worker sedang sibuk.
+    void ParallelFor(size_t count, std::function<void(size_t)> body);
+
+    void CancelAll();
+    size_t GetThreadCount() const { return workers.size(); }
+
+private:
+    struct Job {
+        std::shared_ptr<TaskState> state;
+        std::function<void()> run;
+    };
+
+    void Enqueue(std::shared_ptr<TaskState> state, std::function<void()> run);
+    void WorkerLoop();
+
+    std::vector<std::thread> workers;
+    std::deque<Job> jobs;
+    std::vector<std::weak_ptr<TaskState>> running;
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    bool stopping;
+};